@@ -15,6 +15,7 @@ AudioPlayer::AudioPlayer(engine::resource::ResourceManager* resource_manager)
 }
 
 int AudioPlayer::playSound(std::string_view sound_path, int channel) {
+    std::lock_guard lock(mutex_);
 
     Mix_Chunk* chunk = resource_manager_->getSound(sound_path); // 通过 ResourceManager 获取资源
     if (!chunk) {
@@ -32,6 +33,7 @@ int AudioPlayer::playSound(std::string_view sound_path, int channel) {
 }
 
 bool AudioPlayer::playMusic(std::string_view music_path, int loops, int fade_in_ms) {
+    std::lock_guard lock(mutex_);
     if (music_path == current_music_) return true;      // 如果当前音乐已经在播放，则不重复播放
     current_music_ = music_path;
     Mix_Music* music = resource_manager_->getMusic(music_path); // 通过 ResourceManager 获取资源
@@ -58,6 +60,7 @@ bool AudioPlayer::playMusic(std::string_view music_path, int loops, int fade_in_
 }
 
 void AudioPlayer::stopMusic(int fade_out_ms) {
+    std::lock_guard lock(mutex_);
     if (fade_out_ms > 0) {
         Mix_FadeOutMusic(fade_out_ms);  // 淡出音乐
     } else {
@@ -67,16 +70,19 @@ void AudioPlayer::stopMusic(int fade_out_ms) {
 }
 
 void AudioPlayer::pauseMusic() {
+    std::lock_guard lock(mutex_);
     Mix_PauseMusic();
     spdlog::trace("AudioPlayer: 暂停音乐。");
 }
 
 void AudioPlayer::resumeMusic() {
+    std::lock_guard lock(mutex_);
     Mix_ResumeMusic();
     spdlog::trace("AudioPlayer: 恢复音乐。");
 }
 
 void AudioPlayer::setSoundVolume(float volume, int channel) {
+    std::lock_guard lock(mutex_);
     // 将浮点音量(0-1)转换为SDL_mixer的音量(0-128)
     int sdl_volume = static_cast<int>(glm::max(0.0f, glm::min(1.0f, volume)) * MIX_MAX_VOLUME);
     Mix_Volume(channel, sdl_volume);
@@ -84,18 +90,21 @@ void AudioPlayer::setSoundVolume(float volume, int channel) {
 }
 
 void AudioPlayer::setMusicVolume(float volume) {
+    std::lock_guard lock(mutex_);
     int sdl_volume = static_cast<int>(glm::max(0.0f, glm::min(1.0f, volume)) * MIX_MAX_VOLUME);
     Mix_VolumeMusic(sdl_volume);
     spdlog::trace("AudioPlayer: 设置音乐音量为 {:.2f}。", volume);
 }
 
 float AudioPlayer::getMusicVolume() {
+    std::lock_guard lock(mutex_);
     // SDL_mixer的音量(0-128)转为 0～1.0 的浮点数
     return static_cast<float>(Mix_VolumeMusic(-1)) / static_cast<float>(MIX_MAX_VOLUME);
                             /* 参数 -1 表示查询当前音量 */
 }
 
 float AudioPlayer::getSoundVolume(int channel) {
+    std::lock_guard lock(mutex_);
     return static_cast<float>(Mix_Volume(channel, -1)) / static_cast<float>(MIX_MAX_VOLUME);
 }
 
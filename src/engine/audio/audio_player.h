@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <string_view>
+#include <mutex>
 
 namespace engine::resource {
     class ResourceManager;
@@ -16,11 +17,13 @@ namespace engine::audio {
  *
  * 提供播放音效和音乐的方法，使用由 ResourceManager 管理的资源。
  * 必须使用有效的 ResourceManager 实例初始化。
+ * 所有方法由互斥锁保护，可以在并行的更新阶段 (例如 AI 行为) 中调用。
  */
 class AudioPlayer final{
 private:
     engine::resource::ResourceManager* resource_manager_;   ///< @brief 指向 ResourceManager 的非拥有指针，用于加载和管理音频资源。
     std::string current_music_;         ///< @brief 当前正在播放的音乐路径，用于避免重复播放同一音乐。
+    std::mutex mutex_;                  ///< @brief 保护资源加载和混音器调用 (并行更新阶段可能同时播放音效)
 
 public:
     /**
@@ -2,6 +2,7 @@
 #include "sprite_component.h"
 #include "../object/game_object.h"
 #include "../render/animation.h"
+#include <algorithm>
 #include <spdlog/spdlog.h>
 
 namespace engine::component {
@@ -46,17 +47,35 @@ void AnimationComponent::update(float delta_time, engine::core::Context&) {
     }
 }
 
-void AnimationComponent::addAnimation(std::unique_ptr<engine::render::Animation> animation) {
+void AnimationComponent::addAnimation(std::shared_ptr<engine::render::Animation> animation) {
     if (!animation) return;
     std::string_view name = animation->getName();    // 获取名称
-    animations_[std::string(name)] = std::move(animation);
+    auto name_id = animation->getNameId();
+    auto it = std::find_if(animations_.begin(), animations_.end(), [name_id](const auto& entry) { return entry.first == name_id; });
+    if (it != animations_.end()) {
+        it->second = std::move(animation);       // 同名动画直接替换
+    } else if (!animations_.push_back({name_id, std::move(animation)})) {
+        spdlog::error("GameObject '{}' 的动画数量超过上限 {}，忽略动画 '{}'", owner_ ? owner_->getName() : "未知", animations_.capacity(), name);
+        return;
+    }
     spdlog::debug("已将动画 '{}' 添加到 GameObject '{}'", name, owner_ ? owner_->getName() : "未知");
 }
 
 void AnimationComponent::playAnimation(std::string_view name) {
-    auto it = animations_.find(std::string(name));
+    // 从未驻留过的名称不可能是任何动画的名称 (查找不会分配内存)
+    auto name_id = engine::utils::StringInterner::global().find(name);
+    if (!name_id) {
+        spdlog::warn("未找到 GameObject '{}' 的动画 '{}'", owner_ ? owner_->getName() : "未知", name);
+        return;
+    }
+    playAnimation(*name_id);
+}
+
+void AnimationComponent::playAnimation(engine::utils::StringId name_id) {
+    auto it = std::find_if(animations_.begin(), animations_.end(), [name_id](const auto& entry) { return entry.first == name_id; });
     if (it == animations_.end() || !it->second) {
-        spdlog::warn("未找到 GameObject '{}' 的动画 '{}'", name, owner_ ? owner_->getName() : "未知");
+        spdlog::warn("未找到 GameObject '{}' 的动画 '{}'", owner_ ? owner_->getName() : "未知",
+                     engine::utils::StringInterner::global().view(name_id));
         return;
     }
 
@@ -73,7 +92,7 @@ void AnimationComponent::playAnimation(std::string_view name) {
     if (sprite_component_ && !current_animation_->isEmpty()) {
         const auto& first_frame = current_animation_->getFrame(0.0f);
         sprite_component_->setSourceRect(first_frame.source_rect);
-        spdlog::debug("GameObject '{}' 播放动画 '{}'", owner_ ? owner_->getName() : "未知", name);
+        spdlog::debug("GameObject '{}' 播放动画 '{}'", owner_ ? owner_->getName() : "未知", current_animation_->getName());
     }
 }
 
@@ -1,8 +1,10 @@
 #pragma once
 #include "./component.h"
-#include <string>
+#include "../utils/fixed_vector.h"
+#include "../utils/string_interner.h"
+#include <cstddef>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 #include <memory>
 
 namespace engine::render {
@@ -11,6 +13,9 @@ namespace engine::render {
 namespace engine::component {
     class SpriteComponent;
 }
+namespace engine::scene {
+    class Scene;
+}
 
 namespace engine::component {
 
@@ -20,11 +25,16 @@ namespace engine::component {
  * 持有一组Animation对象并控制其播放，
  * 根据当前帧更新关联的SpriteComponent。
  */
-class AnimationComponent : public Component {
+class AnimationComponent final : public Component {
     friend class engine::object::GameObject;
+    friend class engine::scene::Scene;      // 场景的动画系统直接遍历组件池调用 update()
+public:
+    static constexpr std::size_t MAX_ANIMATIONS = 16;   ///< @brief 每个组件最多持有的动画数量
+
 private:
-    /// @brief 动画名称到Animation对象的映射。
-    std::unordered_map<std::string, std::unique_ptr<engine::render::Animation>> animations_;
+    /// @brief 动画名称ID和Animation对象 (动画数据只读，可以在多个组件之间共享)。
+    /// 每个对象的动画只有几个，直接存放在组件内按ID线性查找，添加动画时不分配内存
+    engine::utils::FixedVector<std::pair<engine::utils::StringId, std::shared_ptr<engine::render::Animation>>, MAX_ANIMATIONS> animations_;
     SpriteComponent* sprite_component_ = nullptr;               ///< @brief 指向必需的SpriteComponent的指针
     engine::render::Animation* current_animation_ = nullptr;    ///< @brief 指向当前播放动画的原始指针
 
@@ -33,6 +43,11 @@ private:
     bool is_one_shot_removal_ = false;      ///< @brief 是否在动画结束后删除整个GameObject
 
 public:
+    static constexpr bool POOLED = true;        ///< @brief 热点组件，从对象池连续分配
+    static constexpr bool HAS_RENDER = false;   ///< @brief 不参与渲染
+    static constexpr UpdatePhase UPDATE_PHASE = UpdatePhase::ANIMATION;     ///< @brief 只推进自身计时器，可并行更新
+    static constexpr bool SYSTEM_UPDATE = true;     ///< @brief 由场景的动画系统按组件池顺序更新
+
     AnimationComponent() = default;
     ~AnimationComponent() override;
 
@@ -42,8 +57,9 @@ public:
     AnimationComponent(AnimationComponent&&) = delete;
     AnimationComponent& operator=(AnimationComponent&&) = delete;
 
-    void addAnimation(std::unique_ptr<engine::render::Animation> animation);    ///< @brief 向 animations_ map容器中添加一个动画。
+    void addAnimation(std::shared_ptr<engine::render::Animation> animation);    ///< @brief 向 animations_ map容器中添加一个动画 (可传入独占或共享的动画)。
     void playAnimation(std::string_view name);    ///< @brief 播放指定名称的动画。
+    void playAnimation(engine::utils::StringId name_id);    ///< @brief 播放指定名称ID的动画 (名称ID来自 internString)。
     void stopAnimation() { is_playing_ = false; }   ///< @brief 停止当前动画播放。
     void resumeAnimation() {is_playing_ = true; }   ///< @brief 恢复当前动画播放。
 
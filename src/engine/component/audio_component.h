@@ -28,6 +28,9 @@ private:
     std::unordered_map<std::string, std::string> sound_id_to_path_; ///< @brief 音效id 到路径的映射表
 
 public:
+    static constexpr bool HAS_UPDATE = false;   ///< @brief update() 为空，无需每帧调用
+    static constexpr bool HAS_RENDER = false;   ///< @brief 不参与渲染
+
     AudioComponent(engine::audio::AudioPlayer* audio_player, engine::render::Camera* camera);
     ~AudioComponent() override = default;
 
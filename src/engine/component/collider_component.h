@@ -1,6 +1,7 @@
 #pragma once
 #include "./component.h"
 #include "../physics/collider.h"
+#include "../physics/collision_layer.h"
 #include "../utils/math.h"
 #include "../utils/alignment.h"
 #include <memory>
@@ -29,7 +30,13 @@ private:
     bool is_trigger_ = false;                               ///< @brief 是否为触发器 (仅检测碰撞，不产生物理响应)
     bool is_active_ = true;                                 ///< @brief 是否激活
 
+    std::uint32_t category_ = engine::physics::CollisionLayer::DEFAULT; ///< @brief 碰撞类别 (位掩码)
+    std::uint32_t mask_ = engine::physics::CollisionLayer::ALL;         ///< @brief 可与之碰撞的类别 (位掩码)
+
 public:
+    static constexpr bool HAS_UPDATE = false;   ///< @brief update() 为空，无需每帧调用
+    static constexpr bool HAS_RENDER = false;   ///< @brief 不参与渲染
+
     /**
      * @brief 构造函数。
      * @param collider 指向 Collider 实例的 unique_ptr，所有权将被转移。
@@ -58,11 +65,24 @@ public:
     engine::utils::Rect getWorldAABB() const;           ///< @brief 获取世界坐标系下的最小轴对齐包围盒（AABB）。
     bool isTrigger() const { return is_trigger_; }      ///< @brief 检查此碰撞器是否为触发器。
     bool isActive() const { return is_active_; }        ///< @brief 检查此碰撞器是否激活。
+    std::uint32_t getCategory() const { return category_; }    ///< @brief 获取碰撞类别。
+    std::uint32_t getMask() const { return mask_; }            ///< @brief 获取碰撞掩码。
+    /// @brief 检查两个碰撞器的类别和掩码是否允许相互碰撞（双向检查）。
+    bool canCollideWith(const ColliderComponent& other) const {
+        return (category_ & other.mask_) != 0 && (other.category_ & mask_) != 0;
+    }
 
     void setAlignment(engine::utils::Alignment anchor);             ///< @brief 设置新的对齐方式并重新计算偏移量。
     void setOffset(glm::vec2 offset) { offset_ = std::move(offset); }   ///< @brief 设置偏移量。
     void setTrigger(bool is_trigger) { is_trigger_ = is_trigger; }  ///< @brief 设置此碰撞器是否为触发器。
     void setActive(bool is_active) { is_active_ = is_active; }      ///< @brief 设置此碰撞器是否激活。
+    void setCategory(std::uint32_t category) { category_ = category; }  ///< @brief 设置碰撞类别。
+    void setMask(std::uint32_t mask) { mask_ = mask; }                  ///< @brief 设置碰撞掩码。
+    /// @brief 设置碰撞类别，同时将掩码重置为该类别的默认掩码。
+    void setCollisionLayer(std::uint32_t category) {
+        category_ = category;
+        mask_ = engine::physics::defaultMaskFor(category);
+    }
 
 private:
     // 核心循环方法
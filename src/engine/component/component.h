@@ -1,4 +1,11 @@
 #pragma once
+#include "../utils/pool_allocator.h"
+#include "update_phase.h"
+#include <cstddef>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
 // 前置声明
 namespace engine::object {
     class GameObject;
@@ -23,6 +30,14 @@ protected:
     engine::object::GameObject* owner_ = nullptr;   ///< @brief 指向拥有此组件的 GameObject
 
 public:
+    // --- 组件类型特性，派生类可以用同名常量覆盖，由 GameObject 在编译期读取 ---
+    static constexpr bool POOLED = false;       ///< @brief 是否从 ComponentPool 分配 (每帧大量存在的热点组件)
+    static constexpr bool HAS_UPDATE = true;    ///< @brief update() 是否有实际工作 (为 false 时 GameObject 不会调用)
+    static constexpr bool HAS_RENDER = true;    ///< @brief render() 是否有实际工作 (为 false 时 GameObject 不会调用)
+    static constexpr UpdatePhase UPDATE_PHASE = UpdatePhase::POST_PHYSICS;  ///< @brief update() 所属的更新阶段
+    /// @brief update() 是否由场景的系统遍历组件池直接调用 (为 true 时不加入 GameObject 的阶段列表，要求 POOLED)
+    static constexpr bool SYSTEM_UPDATE = false;
+
     Component() = default;
     virtual ~Component() = default;         ///< @brief 虚析构函数确保正确清理派生类
 
@@ -32,6 +47,10 @@ public:
     Component(Component&&) = delete;
     Component& operator=(Component&&) = delete;
 
+    // 未池化的组件也从尺寸分级的池分配器中分配，避免频繁创建/销毁时的系统内存分配
+    static void* operator new(std::size_t size) { return engine::utils::PoolAllocator::global().allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) noexcept { engine::utils::PoolAllocator::global().deallocate(ptr, size); }
+
     void setOwner(engine::object::GameObject* owner) { owner_ = owner; }    ///< @brief 设置拥有此组件的 GameObject
     engine::object::GameObject* getOwner() const { return owner_; }         ///< @brief 获取拥有此组件的 GameObject
 
@@ -44,4 +63,36 @@ protected:
     virtual void clean() {}                                             ///< @brief 清理
 };
 
+/// @brief 组件类型ID，用作 GameObject 组件槽位的下标
+using ComponentTypeId = std::size_t;
+/// @brief 组件类型数量上限 (即每个 GameObject 的组件槽位数)
+constexpr ComponentTypeId MAX_COMPONENT_TYPES = 32;
+
+namespace detail {
+/// @brief 分配下一个组件类型ID (线程安全)
+inline ComponentTypeId nextComponentTypeId() {
+    static std::atomic<ComponentTypeId> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace detail
+
+/**
+ * @brief 获取组件类型 T 的ID。
+ *
+ * 每种类型在第一次使用时分配一个从0开始的连续ID，之后的调用只是读取一个静态变量。
+ * 同一次运行中ID保持不变，但不同运行之间的分配顺序可能不同，因此不要将其持久化。
+ * @throw std::runtime_error 组件类型数量超过 MAX_COMPONENT_TYPES 时抛出。
+ */
+template <typename T>
+ComponentTypeId getComponentTypeId() {
+    static const ComponentTypeId id = [] {
+        auto next = detail::nextComponentTypeId();
+        if (next >= MAX_COMPONENT_TYPES) {
+            throw std::runtime_error("组件类型数量超过上限 MAX_COMPONENT_TYPES (" + std::to_string(MAX_COMPONENT_TYPES) + ")。");
+        }
+        return next;
+    }();
+    return id;
+}
+
 } // namespace engine::component
\ No newline at end of file
@@ -0,0 +1,172 @@
+#pragma once
+#include "./component.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace engine::component {
+
+/**
+ * @brief 组件对象池：按块 (BLOCK_SIZE 个) 连续分配同一类型的组件。
+ *
+ * 同类组件在内存中紧密排列，遍历时缓存命中率更高；销毁的组件槽位归还空闲列表，
+ * 后续创建总是使用序号最小的空闲槽位，使存活的组件集中在池的前部。块一经分配不会移动或释放 (直到程序结束)，
+ * 因此组件地址在整个生命周期内保持稳定，可以安全地被其它对象以裸指针引用。
+ * 每种类型只有一个全局实例，创建/销毁由互斥锁保护。
+ * 场景的系统可以用 forEachLive() 按内存顺序直接遍历存活的组件，而不必经过游戏对象和虚函数调用；
+ * 遍历范围只需到 getLiveExtent() (最后一个存活组件之后)，不会因为曾经创建过大量组件而一直变慢。
+ * @tparam T 组件类型
+ */
+template <typename T>
+class ComponentPool final {
+public:
+    static constexpr std::size_t BLOCK_SIZE = 128;  ///< @brief 每块包含的组件数量
+
+private:
+    /// @brief 一个组件大小的未初始化存储 (data 位于开头，组件地址即槽位地址)
+    struct alignas(T) Slot {
+        std::byte data[sizeof(T)];
+        std::size_t index = 0;  ///< @brief 槽位序号 (块序号 * BLOCK_SIZE + 块内序号)
+        bool live = false;      ///< @brief 槽位中是否有存活的组件
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> blocks_;   ///< @brief 已分配的内存块
+    std::vector<std::size_t> free_slots_;           ///< @brief 空闲槽位序号 (最小堆，优先复用序号小的槽位)
+    std::size_t live_count_ = 0;                    ///< @brief 当前存活的组件数量
+    std::size_t live_extent_ = 0;                   ///< @brief 最后一个存活组件的序号 + 1
+    std::mutex mutex_;                              ///< @brief 保护以上数据
+
+    ComponentPool() = default;
+
+public:
+    // 禁止拷贝和移动
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+    ComponentPool(ComponentPool&&) = delete;
+    ComponentPool& operator=(ComponentPool&&) = delete;
+
+    /// @brief 获取类型 T 的全局对象池
+    static ComponentPool& get() {
+        static ComponentPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief 在池中构造一个组件。
+     * @param args 组件构造函数参数
+     * @return 组件指针，必须通过 destroy() 释放
+     */
+    template <typename... Args>
+    T* create(Args&&... args) {
+        Slot* slot = acquireSlot();
+        try {
+            return ::new (static_cast<void*>(slot->data)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            releaseSlot(slot);   // 构造失败时归还槽位
+            throw;
+        }
+    }
+
+    /// @brief 析构组件并归还槽位
+    void destroy(T* component) {
+        if (!component) return;
+        component->~T();
+        releaseSlot(reinterpret_cast<Slot*>(component));
+    }
+
+    /// @brief 当前存活的组件数量
+    std::size_t getLiveCount() {
+        std::lock_guard lock(mutex_);
+        return live_count_;
+    }
+    /// @brief 已分配的槽位总数
+    std::size_t getCapacity() {
+        std::lock_guard lock(mutex_);
+        return blocks_.size() * BLOCK_SIZE;
+    }
+    /// @brief 存活组件所在的序号范围 [0, extent)，遍历存活组件只需到这里
+    std::size_t getLiveExtent() {
+        std::lock_guard lock(mutex_);
+        return live_extent_;
+    }
+
+    /**
+     * @brief 按内存顺序遍历槽位序号 [begin, end) 范围内存活的组件 (end 超出已分配的槽位时截断)。
+     *
+     * 不加锁：调用者需保证遍历期间没有线程创建/销毁该类型的组件 (场景只在主线程上增删对象)。
+     * 不同范围之间互不影响，可以把 [0, getLiveExtent()) 分块交给多个线程并行遍历。
+     * @param func 对每个存活组件调用 func(T&)
+     */
+    template <typename F>
+    void forEachLive(std::size_t begin, std::size_t end, F&& func) {
+        end = std::min(end, blocks_.size() * BLOCK_SIZE);
+        while (begin < end) {
+            Slot* block = blocks_[begin / BLOCK_SIZE].get();
+            std::size_t block_end = std::min(end, (begin / BLOCK_SIZE + 1) * BLOCK_SIZE);
+            for (std::size_t i = begin % BLOCK_SIZE, last = i + (block_end - begin); i < last; ++i) {
+                if (block[i].live) func(*std::launder(reinterpret_cast<T*>(block[i].data)));
+            }
+            begin = block_end;
+        }
+    }
+
+private:
+    Slot& slotAt(std::size_t index) { return blocks_[index / BLOCK_SIZE][index % BLOCK_SIZE]; }
+
+    Slot* acquireSlot() {
+        std::lock_guard lock(mutex_);
+        if (free_slots_.empty()) {
+            auto first = blocks_.size() * BLOCK_SIZE;
+            auto& block = blocks_.emplace_back(std::make_unique<Slot[]>(BLOCK_SIZE));
+            // 新块的序号都大于已有的槽位，按递增顺序压入即满足最小堆
+            for (std::size_t i = 0; i < BLOCK_SIZE; ++i) {
+                block[i].index = first + i;
+                free_slots_.push_back(first + i);
+            }
+        }
+        std::pop_heap(free_slots_.begin(), free_slots_.end(), std::greater<>{});
+        Slot* slot = &slotAt(free_slots_.back());
+        free_slots_.pop_back();
+        slot->live = true;
+        ++live_count_;
+        live_extent_ = std::max(live_extent_, slot->index + 1);
+        return slot;
+    }
+
+    void releaseSlot(Slot* slot) {
+        std::lock_guard lock(mutex_);
+        slot->live = false;
+        free_slots_.push_back(slot->index);
+        std::push_heap(free_slots_.begin(), free_slots_.end(), std::greater<>{});
+        --live_count_;
+        // 末尾的组件被销毁时收缩遍历范围 (每个槽位收缩前必然先被创建过一次，均摊 O(1))
+        while (live_extent_ > 0 && !slotAt(live_extent_ - 1).live) {
+            --live_extent_;
+        }
+    }
+};
+
+/**
+ * @brief GameObject 持有组件时使用的删除器：池化组件归还对象池，其它组件直接 delete。
+ */
+struct ComponentDeleter {
+    void (*destroy)(Component*) = nullptr;  ///< @brief 池化组件的销毁函数 (为空表示普通堆分配)
+
+    void operator()(Component* component) const {
+        if (destroy) destroy(component);
+        else delete component;
+    }
+};
+
+/// @brief 生成类型 T 的池化销毁函数
+template <typename T>
+void destroyPooledComponent(Component* component) {
+    ComponentPool<T>::get().destroy(static_cast<T*>(component));
+}
+
+} // namespace engine::component
@@ -16,6 +16,8 @@ private:
     float invincibility_timer_ = 0.0f;      ///< @brief 无敌时间计时器（秒）
 
 public:
+    static constexpr bool HAS_RENDER = false;   ///< @brief 不参与渲染
+
     /**
      * @brief 构造函数
      * @param max_health 最大生命值，默认为 1
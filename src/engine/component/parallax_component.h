@@ -24,6 +24,8 @@ private:
     bool is_hidden_ = false;                    ///< @brief 是否隐藏（不渲染）
 
 public:
+    static constexpr bool HAS_UPDATE = false;   ///< @brief update() 为空，无需每帧调用
+
     /**
      * @brief 构造函数
      * @param texture_id 背景纹理的资源 ID。
@@ -1,7 +1,10 @@
 #pragma once
 #include "component.h"
+#include "../physics/tile_trigger.h"
 #include "glm/vec2.hpp"
 #include <utility>
+#include <cstdint>
+#include <cstddef>
 
 namespace engine::physics {
     class PhysicsEngine;
@@ -18,24 +21,32 @@ class TransformComponent;
 class PhysicsComponent final: public Component {
     friend class engine::object::GameObject;
 public:
+    static constexpr bool POOLED = true;        ///< @brief 热点组件，从对象池连续分配
+    static constexpr bool HAS_UPDATE = false;   ///< @brief update() 为空，无需每帧调用
+    static constexpr bool HAS_RENDER = false;   ///< @brief 不参与渲染
+    static constexpr std::size_t NO_BODY_INDEX = static_cast<std::size_t>(-1);  ///< @brief 尚未注册到物理引擎
+
     glm::vec2 velocity_ = {0.0f, 0.0f};             ///< @brief 物体的速度，设为公共成员变量，方便PhysicsEngine访问更新
 
 private:
     engine::physics::PhysicsEngine* physics_engine_ = nullptr;  ///< @brief 指向PhysicsEngine的指针
     TransformComponent* transform_ = nullptr;                   ///< @brief TransformComponent的缓存指针
+    std::size_t body_index_ = NO_BODY_INDEX;                    ///< @brief 在 PhysicsEngine 物体表中的序号 (由 BodyStore 维护)
 
     glm::vec2 force_ = {0.0f, 0.0f};                            ///< @brief 当前帧受到的力
     float mass_ = 1.0f;                             ///< @brief 物体质量（默认1.0）
     bool use_gravity_ = true;                       ///< @brief 物体是否受重力影响
     bool enabled_ = true;                           ///< @brief 组件是否激活
+    bool frozen_ = false;                           ///< @brief 是否被冻结 (离开活动区域时由场景设置，状态保持不变直到解冻)
+    float catch_up_time_ = 0.0f;                    ///< @brief 需要额外补上的模拟时间 (降频更新的对象在更新帧补上冻结期间的时间)
 
     // --- 碰撞状态标志 ---
     bool collided_below_ = false;
     bool collided_above_ = false;
     bool collided_left_ = false;
     bool collided_right_ = false;
-    bool collided_ladder_ = false;      ///< @brief 是否与梯子发生碰撞
     bool is_on_top_ladder_ = false;     ///< @brief 是否在梯子顶层（梯子上方没有瓦片）
+    std::uint8_t tile_triggers_ = engine::physics::TileTrigger::NONE;  ///< @brief 当前覆盖的瓦片触发器 (TileTrigger 掩码，梯子判断也由此得出)
 
 public:
     /**
@@ -66,9 +77,15 @@ public:
     void setEnabled(bool enabled) { enabled_ = enabled; }                       ///< @brief 设置组件是否启用
     void setMass(float mass) { mass_ = (mass >= 0.0f) ? mass : 1.0f; }          ///< @brief 设置质量，质量不能为负
     void setUseGravity(bool use_gravity) { use_gravity_ = use_gravity; }        ///< @brief 设置组件是否受重力影响
+    void setFrozen(bool frozen) { frozen_ = frozen; }                           ///< @brief 设置是否冻结 (冻结的物体不模拟，解冻后从冻结时的状态继续)
+    bool isFrozen() const { return frozen_; }                                   ///< @brief 获取是否冻结
+    void addCatchUpTime(float time) { catch_up_time_ += time; }                 ///< @brief 请求物理引擎额外补上一段模拟时间 (按步长分步模拟)
+    float takeCatchUpTime() { return std::exchange(catch_up_time_, 0.0f); }     ///< @brief 取出并清零待补上的模拟时间 (供 PhysicsEngine 使用)
     void setVelocity(glm::vec2 velocity) { velocity_ = std::move(velocity); }       ///< @brief 设置速度
     const glm::vec2& getVelocity() const { return velocity_; }                  ///< @brief 获取当前速度
     TransformComponent* getTransform() const { return transform_; }             ///< @brief 获取TransformComponent指针
+    std::size_t getBodyIndex() const { return body_index_; }                    ///< @brief 获取在物体表中的序号，未注册时为 NO_BODY_INDEX
+    void setBodyIndex(std::size_t index) { body_index_ = index; }               ///< @brief 设置在物体表中的序号 (仅供 BodyStore 使用)
 
     // --- 碰撞状态访问与修改 (供 PhysicsEngine 使用) ---
     /** @brief 重置所有碰撞标志 (在物理更新开始时调用) */
@@ -77,7 +94,6 @@ public:
         collided_above_ = false;
         collided_left_ = false;
         collided_right_ = false;
-        collided_ladder_ = false;
         is_on_top_ladder_ = false;
     }
 
@@ -85,14 +101,15 @@ public:
     void setCollidedAbove(bool collided) { collided_above_ = collided; }    ///< @brief 设置上方碰撞标志
     void setCollidedLeft(bool collided) { collided_left_ = collided; }      ///< @brief 设置左方碰撞标志
     void setCollidedRight(bool collided) { collided_right_ = collided; }    ///< @brief 设置右方碰撞标志
-    void setCollidedLadder(bool collided) { collided_ladder_ = collided; }  ///< @brief 设置梯子碰撞标志
+    void setTileTriggers(std::uint8_t triggers) { tile_triggers_ = triggers; }  ///< @brief 设置当前覆盖的瓦片触发器掩码
     void setOnTopLadder(bool on_top) { is_on_top_ladder_ = on_top; }        ///< @brief 设置是否在梯子顶层
 
     bool hasCollidedBelow() const { return collided_below_; }       ///< @brief 检查是否与下方发生碰撞
     bool hasCollidedAbove() const { return collided_above_; }       ///< @brief 检查是否与上方发生碰撞
     bool hasCollidedLeft() const { return collided_left_; }         ///< @brief 检查是否与左方发生碰撞
     bool hasCollidedRight() const { return collided_right_; }       ///< @brief 检查是否与右方发生碰撞
-    bool hasCollidedLadder() const { return collided_ladder_; }     ///< @brief 检查是否与梯子发生碰撞
+    bool hasCollidedLadder() const { return tile_triggers_ & engine::physics::TileTrigger::LADDER; }   ///< @brief 检查是否与梯子发生碰撞
+    std::uint8_t getTileTriggers() const { return tile_triggers_; }  ///< @brief 获取当前覆盖的瓦片触发器 (TileTrigger 掩码)
     bool isOnTopLadder() const { return is_on_top_ladder_; }        ///< @brief 检查是否在梯子顶层
 
 private:
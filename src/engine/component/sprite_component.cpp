@@ -91,8 +91,8 @@ void SpriteComponent::render(engine::core::Context& context) {
         return;
     }
 
-    // 获取变换信息（考虑偏移量）
-    const glm::vec2& pos = transform_->getPosition() + offset_;
+    // 获取变换信息（考虑偏移量和物理插值）
+    const glm::vec2& pos = transform_->getRenderPosition() + offset_;
     const glm::vec2& scale = transform_->getScale();
     float rotation_degrees = transform_->getRotation();
 
@@ -37,6 +37,9 @@ private:
     bool is_hidden_ = false;                                                ///< @brief 是否隐藏（不渲染）
     
 public:
+    static constexpr bool POOLED = true;        ///< @brief 热点组件，从对象池连续分配
+    static constexpr bool HAS_UPDATE = false;   ///< @brief update() 为空，无需每帧调用
+
     /**
      * @brief 构造函数
      * @param texture_id 纹理资源的标识符。
@@ -63,6 +63,8 @@ private:
     engine::physics::PhysicsEngine* physics_engine_ = nullptr;   ///< @brief 物理引擎的指针， clean()函数中可能需要反注册
 
 public:
+    static constexpr bool HAS_UPDATE = false;   ///< @brief update() 为空，无需每帧调用
+
     TileLayerComponent() = default;
 
     /**
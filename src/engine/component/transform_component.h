@@ -12,9 +12,14 @@ namespace engine::component {
 class TransformComponent final : public Component {
     friend class engine::object::GameObject;        // 友元不能继承，必须每个子类单独添加
 public:
+    static constexpr bool POOLED = true;        ///< @brief 热点组件，从对象池连续分配
+    static constexpr bool HAS_UPDATE = false;   ///< @brief update() 为空，无需每帧调用
+    static constexpr bool HAS_RENDER = false;   ///< @brief 不参与渲染
+
     glm::vec2 position_ = {0.0f, 0.0f};     ///< @brief 位置
     glm::vec2 scale_ = {1.0f, 1.0f};        ///< @brief 缩放
     float rotation_ = 0.0f;                 ///< @brief 角度制，单位：度
+    glm::vec2 render_offset_ = {0.0f, 0.0f};    ///< @brief 渲染插值偏移（由物理引擎设置，渲染位置 = 位置 + 偏移）
 
     /**
      * @brief 构造函数
@@ -33,9 +38,13 @@ public:
 
     // Getters and setters 
     const glm::vec2& getPosition() const { return position_; }              ///< @brief 获取位置
+    glm::vec2 getRenderPosition() const { return position_ + render_offset_; }  ///< @brief 获取渲染位置（包含插值偏移）
+    const glm::vec2& getRenderOffset() const { return render_offset_; }     ///< @brief 获取渲染插值偏移
     float getRotation() const { return rotation_; }                         ///< @brief 获取旋转
     const glm::vec2& getScale() const { return scale_; }                    ///< @brief 获取缩放
-    void setPosition(glm::vec2 position) { position_ = std::move(position); }   ///< @brief 设置位置
+    /// @brief 设置位置（同时清除渲染插值偏移，避免瞬移后画面出现拖影）
+    void setPosition(glm::vec2 position) { position_ = std::move(position); render_offset_ = {0.0f, 0.0f}; }
+    void setRenderOffset(glm::vec2 offset) { render_offset_ = std::move(offset); }  ///< @brief 设置渲染插值偏移
     void setRotation(float rotation) { rotation_ = rotation; }                 ///< @brief 设置旋转角度
     void setScale(glm::vec2 scale);                                         ///< @brief 设置缩放，应用缩放时应同步更新Sprite偏移量
     void translate(const glm::vec2& offset) { position_ += offset; }        ///< @brief 平移
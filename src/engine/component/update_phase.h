@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+
+namespace engine::component {
+
+/**
+ * @brief 组件的更新阶段。
+ *
+ * 场景每帧按枚举顺序依次执行各个阶段，同一阶段内按游戏对象顺序、再按组件添加顺序调用 update()。
+ * 物理引擎在 PRE_PHYSICS 与 POST_PHYSICS 之间运行。
+ */
+enum class UpdatePhase {
+    INPUT,          ///< @brief 输入相关的逻辑 (最先执行)
+    AI,             ///< @brief AI 行为 (并行)
+    PRE_PHYSICS,    ///< @brief 物理更新之前 (设置速度、施加力等)
+    POST_PHYSICS,   ///< @brief 物理更新之后 (读取碰撞结果)，默认阶段
+    ANIMATION,      ///< @brief 动画计时 (并行)
+    LATE,           ///< @brief 最后执行 (依赖其它组件本帧结果的逻辑)
+    COUNT           ///< @brief 阶段数量 (不是有效阶段)
+};
+
+constexpr std::size_t UPDATE_PHASE_COUNT = static_cast<std::size_t>(UpdatePhase::COUNT);   ///< @brief 阶段数量
+
+/**
+ * @brief 阶段是否可以在工作线程上并行执行。
+ *
+ * 并行阶段中的组件只能读写自己所属游戏对象的数据 (以及自身带锁的服务，如 AudioPlayer)，
+ * 不能创建/删除游戏对象 (设置 need_remove 标记除外)，也不能访问其它游戏对象。
+ * 可以调用 PhysicsEngine 的只读空间查询 (raycast/raycastTiles/overlapBox/queryNearest)，
+ * 但不能修改物理引擎 (注册/注销组件等)；查询回调中得到的其它对象只能用于判断，不能修改。
+ */
+constexpr bool isParallelPhase(UpdatePhase phase) {
+    return phase == UpdatePhase::AI || phase == UpdatePhase::ANIMATION;
+}
+
+} // namespace engine::component
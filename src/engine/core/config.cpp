@@ -73,6 +73,45 @@ void Config::fromJson(const nlohmann::json& j) {
             spdlog::warn("目标 FPS 不能为负数。设置为 0（无限制）。");
             target_fps_ = 0;
         }
+        worker_threads_ = perf_config.value("worker_threads", worker_threads_);
+        if (worker_threads_ < 0) {
+            spdlog::warn("工作线程数不能为负数。设置为 0（自动）。");
+            worker_threads_ = 0;
+        }
+        activity_culling_ = perf_config.value("activity_culling", activity_culling_);
+        activity_margin_ = perf_config.value("activity_margin", activity_margin_);
+        inactive_update_interval_ = perf_config.value("inactive_update_interval", inactive_update_interval_);
+        if (activity_margin_ < 0.0f) {
+            spdlog::warn("活动区域扩展距离不能为负数。设置为 128。");
+            activity_margin_ = 128.0f;
+        }
+        if (inactive_update_interval_ < 0) {
+            spdlog::warn("活动区域外的更新间隔不能为负数。设置为 0（冻结）。");
+            inactive_update_interval_ = 0;
+        }
+    }
+    if (j.contains("physics")) {
+        const auto& physics_config = j["physics"];
+        physics_fixed_timestep_ = physics_config.value("fixed_timestep", physics_fixed_timestep_);
+        physics_fixed_rate_ = physics_config.value("fixed_rate", physics_fixed_rate_);
+        physics_max_substeps_ = physics_config.value("max_substeps", physics_max_substeps_);
+        physics_interpolation_ = physics_config.value("interpolation", physics_interpolation_);
+        physics_parallel_ = physics_config.value("parallel", physics_parallel_);
+        physics_sleep_enabled_ = physics_config.value("sleep_enabled", physics_sleep_enabled_);
+        physics_sleep_time_ = physics_config.value("sleep_time", physics_sleep_time_);
+        physics_deterministic_ = physics_config.value("deterministic", physics_deterministic_);
+        if (physics_fixed_rate_ <= 0) {
+            spdlog::warn("物理固定步长频率必须为正数。设置为 60。");
+            physics_fixed_rate_ = 60;
+        }
+        if (physics_max_substeps_ < 1) {
+            spdlog::warn("物理最大子步数至少为 1。设置为 1。");
+            physics_max_substeps_ = 1;
+        }
+        if (physics_sleep_time_ < 0.0f) {
+            spdlog::warn("物理休眠时间不能为负数。设置为 0.5。");
+            physics_sleep_time_ = 0.5f;
+        }
     }
     if (j.contains("audio")) {
         const auto& audio_config = j["audio"];
@@ -109,7 +148,21 @@ nlohmann::ordered_json Config::toJson() const {
             {"vsync", vsync_enabled_}
         }},
         {"performance", {
-            {"target_fps", target_fps_}
+            {"target_fps", target_fps_},
+            {"worker_threads", worker_threads_},
+            {"activity_culling", activity_culling_},
+            {"activity_margin", activity_margin_},
+            {"inactive_update_interval", inactive_update_interval_}
+        }},
+        {"physics", {
+            {"fixed_timestep", physics_fixed_timestep_},
+            {"fixed_rate", physics_fixed_rate_},
+            {"max_substeps", physics_max_substeps_},
+            {"interpolation", physics_interpolation_},
+            {"parallel", physics_parallel_},
+            {"sleep_enabled", physics_sleep_enabled_},
+            {"sleep_time", physics_sleep_time_},
+            {"deterministic", physics_deterministic_}
         }},
         {"audio", {
             {"music_volume", music_volume_},
@@ -28,6 +28,20 @@ public:
     // 性能设置
     int target_fps_ = 144;                  ///< @brief 目标 FPS 设置，0 表示不限制
 
+    // 物理设置
+    bool physics_fixed_timestep_ = true;    ///< @brief 是否使用固定时间步长更新物理
+    int physics_fixed_rate_ = 60;           ///< @brief 固定步长的频率 (Hz)
+    int physics_max_substeps_ = 5;          ///< @brief 每帧最多执行的物理子步数
+    bool physics_interpolation_ = true;     ///< @brief 是否对渲染位置进行插值
+    bool physics_parallel_ = true;          ///< @brief 物体较多时是否使用工作线程并行处理积分和瓦片碰撞
+    bool physics_sleep_enabled_ = true;     ///< @brief 是否允许静止的物体休眠
+    float physics_sleep_time_ = 0.5f;       ///< @brief 物体持续静止多久后进入休眠 (秒)
+    bool physics_deterministic_ = false;    ///< @brief 确定性模式：逻辑帧与物理步长固定，并逐帧计算物理状态哈希 (用于复现与对比测试)
+    int worker_threads_ = 0;                ///< @brief 工作线程数，0 表示自动 (硬件线程数 - 1)
+    bool activity_culling_ = true;          ///< @brief 是否只更新相机附近 (活动区域内) 的对象
+    float activity_margin_ = 128.0f;        ///< @brief 活动区域在视口四周扩展的距离 (像素)
+    int inactive_update_interval_ = 0;      ///< @brief 活动区域外的对象每隔多少帧更新一次 (逻辑和物理都补上间隔内的时间)，0 表示完全冻结
+
     // 音频设置
     float music_volume_ = 0.5f;
     float sound_volume_ = 0.5f;
@@ -42,6 +56,7 @@ public:
         {"jump", {"J", "Space"}},
         {"attack", {"K", "MouseLeft"}},
         {"pause", {"P", "Escape"}},
+        {"toggle_physics_stats", {"F3"}},
         // 可以继续添加更多默认动作
     };
 
@@ -17,7 +17,8 @@ Context::Context(engine::input::InputManager& input_manager,
                  engine::resource::ResourceManager& resource_manager,
                  engine::physics::PhysicsEngine& physics_engine,
                  engine::audio::AudioPlayer& audio_player,
-                 engine::core::GameState& game_state)     
+                 engine::core::GameState& game_state,
+                 engine::core::ThreadPool& thread_pool)
     : input_manager_(input_manager),
       renderer_(renderer),
       camera_(camera),
@@ -25,7 +26,8 @@ Context::Context(engine::input::InputManager& input_manager,
       resource_manager_(resource_manager),
       physics_engine_(physics_engine),
       audio_player_(audio_player),
-      game_state_(game_state)
+      game_state_(game_state),
+      thread_pool_(thread_pool)
 {
     spdlog::trace("上下文已创建并初始化。");
 }
@@ -24,6 +24,7 @@ namespace engine::audio {
 
 namespace engine::core {
     class GameState;
+    class ThreadPool;
 
 /**
  * @brief 持有对核心引擎模块引用的上下文对象。
@@ -41,6 +42,7 @@ private:
     engine::physics::PhysicsEngine& physics_engine_;        ///< @brief 物理引擎
     engine::audio::AudioPlayer& audio_player_;              ///< @brief 音频播放器
     engine::core::GameState& game_state_;                   ///< @brief 游戏状态
+    engine::core::ThreadPool& thread_pool_;                 ///< @brief 线程池 (并行更新阶段使用)
 public:
     /**
      * @brief 构造函数。
@@ -49,6 +51,7 @@ public:
      * @param camera 对 Camera 实例的引用。
      * @param resource_manager 对 ResourceManager 实例的引用。
      * @param physics_engine 对 PhysicsEngine 实例的引用。
+     * @param thread_pool 对 ThreadPool 实例的引用。
      */
     Context(engine::input::InputManager& input_manager,
             engine::render::Renderer& renderer,
@@ -57,7 +60,8 @@ public:
             engine::resource::ResourceManager& resource_manager,
             engine::physics::PhysicsEngine& physics_engine,
             engine::audio::AudioPlayer& audio_player,
-            engine::core::GameState& game_state);
+            engine::core::GameState& game_state,
+            engine::core::ThreadPool& thread_pool);
 
     // 禁止拷贝和移动，Context 对象通常是唯一的或按需创建/传递
     Context(const Context&) = delete;
@@ -74,6 +78,7 @@ public:
     engine::physics::PhysicsEngine& getPhysicsEngine() const { return physics_engine_; }         ///< @brief 获取物理引擎
     engine::audio::AudioPlayer& getAudioPlayer() const { return audio_player_; }                 ///< @brief 获取音频播放器
     engine::core::GameState& getGameState() const { return game_state_; }                         ///< @brief 获取游戏状态
+    engine::core::ThreadPool& getThreadPool() const { return thread_pool_; }                      ///< @brief 获取线程池
 };
 
 } // namespace engine::core
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "context.h"
 #include "config.h"
 #include "game_state.h"
+#include "thread_pool.h"
 #include "../resource/resource_manager.h"
 #include "../audio/audio_player.h"
 #include "../render/renderer.h"
@@ -11,8 +12,11 @@
 #include "../input/input_manager.h"
 #include "../physics/physics_engine.h"
 #include "../scene/scene_manager.h"
+#include "../utils/pool_allocator.h"
+#include "../utils/alloc_counter.h"
 #include <SDL3/SDL.h>
 #include <spdlog/spdlog.h>
+#include <cstdio>
 
 namespace engine::core {
 
@@ -32,6 +36,7 @@ void GameApp::run() {
     }
 
     while (is_running_) {
+        auto heap_allocations_at_start = engine::utils::getHeapAllocationCount();
         time_->update();
         float delta_time = time_->getDeltaTime();
         input_manager_->update();   // 每帧首先更新输入管理器
@@ -39,6 +44,7 @@ void GameApp::run() {
         handleEvents();
         update(delta_time);
         render();
+        frame_heap_allocations_ = engine::utils::getHeapAllocationCount() - heap_allocations_at_start;
 
         // spdlog::info("delta_time: {}", delta_time);
     }
@@ -67,6 +73,7 @@ bool GameApp::init() {
     if (!initCamera()) return false;
     if (!initTextRenderer()) return false;
     if (!initInputManager()) return false;
+    if (!initThreadPool()) return false;
     if (!initPhysicsEngine()) return false;
     if (!initGameState()) return false;
 
@@ -88,6 +95,11 @@ void GameApp::handleEvents() {
         return;
     }
 
+    // 切换物理统计调试信息
+    if (input_manager_->isActionPressed("toggle_physics_stats")) {
+        show_physics_stats_ = !show_physics_stats_;
+    }
+
     scene_manager_->handleInput();
 }
 
@@ -102,11 +114,48 @@ void GameApp::render() {
 
     // 2. 具体渲染代码
     scene_manager_->render();
+    if (show_physics_stats_) {
+        renderPhysicsStats();
+    }
 
     // 3. 更新屏幕显示
     renderer_->present();
 }
 
+void GameApp::renderPhysicsStats() {
+    const auto& stats = physics_engine_->getStats();
+    constexpr std::string_view font_id = "assets/fonts/VonwaonBitmap-16px.ttf";
+    constexpr int font_size = 16;
+    constexpr float line_height = 18.0f;
+    const engine::utils::FColor color = {1.0f, 1.0f, 0.4f, 1.0f};
+
+    // 使用栈上缓冲区格式化，调试信息本身不产生内存分配
+    char lines[8][96];
+    std::snprintf(lines[0], sizeof(lines[0]), "Physics %.3f ms  substeps %d", stats.total_ms, stats.substeps);
+    std::snprintf(lines[1], sizeof(lines[1]), "bodies %zu  sleeping %zu  frozen %zu  integrated %u",
+                  stats.bodies, stats.sleeping_bodies, stats.frozen_bodies, stats.bodies_integrated);
+    std::snprintf(lines[2], sizeof(lines[2]), "integrate %.3f  tiles %.3f  pairs %.3f  triggers %.3f ms",
+                  stats.integrate_ms, stats.tile_resolve_ms, stats.object_pairs_ms, stats.triggers_ms);
+    std::snprintf(lines[3], sizeof(lines[3]), "tile probes %u", stats.tile_probes);
+    std::snprintf(lines[4], sizeof(lines[4]), "broadphase %u  narrowphase %u/%u  solid %u",
+                  stats.broadphase_pairs, stats.narrowphase_hits, stats.narrowphase_tests, stats.solid_resolutions);
+    std::snprintf(lines[5], sizeof(lines[5]), "events: collision %u  trigger %u", stats.collision_events, stats.trigger_events);
+    auto pool_stats = engine::utils::PoolAllocator::global().getStats();
+    std::snprintf(lines[6], sizeof(lines[6]), "pool live %zu  blocks %llu  reserved %zu KB",
+                  pool_stats.live, static_cast<unsigned long long>(pool_stats.block_allocations), pool_stats.reserved_bytes / 1024);
+    if (engine::utils::isHeapTrackingEnabled()) {
+        std::snprintf(lines[7], sizeof(lines[7]), "heap allocs/frame %llu", static_cast<unsigned long long>(frame_heap_allocations_));
+    } else {
+        std::snprintf(lines[7], sizeof(lines[7]), "heap allocs/frame n/a (SUNNYLAND_TRACK_ALLOCATIONS off)");
+    }
+
+    glm::vec2 position = {8.0f, 8.0f};
+    for (const auto* line : lines) {
+        text_renderer_->drawUIText(line, font_id, font_size, position, color);
+        position.y += line_height;
+    }
+}
+
 void GameApp::close() {
     spdlog::trace("关闭 GameApp ...");
     // 先关闭场景管理器，确保所有场景都被清理
@@ -180,6 +229,10 @@ bool GameApp::initTime() {
         return false;
     }
     time_->setTargetFps(config_->target_fps_);
+    // 确定性模式：逻辑帧按物理固定步长推进，与实际帧耗时无关
+    if (config_->physics_deterministic_) {
+        time_->setFixedDeltaTime(1.0 / static_cast<double>(config_->physics_fixed_rate_));
+    }
     spdlog::trace("时间管理初始化成功。");
     return true;
 }
@@ -223,6 +276,9 @@ bool GameApp::initRenderer() {
 bool GameApp::initCamera() {
     try {
         camera_ = std::make_unique<engine::render::Camera>(glm::vec2(config_->window_width_ / 2, config_->window_height_ / 2));
+        camera_->setActivityCullingEnabled(config_->activity_culling_);
+        camera_->setActivityMargin(config_->activity_margin_);
+        camera_->setInactiveUpdateInterval(config_->inactive_update_interval_);
     } catch (const std::exception& e) {
         spdlog::error("初始化相机失败: {}", e.what());
         return false;
@@ -255,10 +311,34 @@ bool GameApp::initInputManager()
     return true;
 }
 
+bool GameApp::initThreadPool()
+{
+    try {
+        thread_pool_ = std::make_unique<engine::core::ThreadPool>(static_cast<std::size_t>(config_->worker_threads_));
+    }
+    catch (const std::exception& e) {
+        spdlog::error("初始化线程池失败: {}", e.what());
+        return false;
+    }
+    spdlog::trace("线程池初始化成功。");
+    return true;
+}
+
 bool GameApp::initPhysicsEngine()
 {
     try {
         physics_engine_ = std::make_unique<engine::physics::PhysicsEngine>();
+        physics_engine_->setFixedTimeStepEnabled(config_->physics_fixed_timestep_);
+        physics_engine_->setFixedTimeStep(1.0f / static_cast<float>(config_->physics_fixed_rate_));
+        physics_engine_->setMaxSubsteps(config_->physics_max_substeps_);
+        physics_engine_->setInterpolationEnabled(config_->physics_interpolation_);
+        physics_engine_->setThreadPool(thread_pool_.get());
+        physics_engine_->setParallelEnabled(config_->physics_parallel_);
+        physics_engine_->setSleepEnabled(config_->physics_sleep_enabled_);
+        physics_engine_->setTimeToSleep(config_->physics_sleep_time_);
+        if (config_->physics_deterministic_) {
+            physics_engine_->setDeterministic(true);
+        }
     }
     catch (const std::exception& e) {
         spdlog::error("初始化物理引擎失败: {}", e.what());
@@ -289,7 +369,8 @@ bool GameApp::initContext()
                                                            *resource_manager_, 
                                                            *physics_engine_, 
                                                            *audio_player_,
-                                                           *game_state_);
+                                                           *game_state_,
+                                                           *thread_pool_);
     } catch (const std::exception& e) {
         spdlog::error("初始化上下文失败: {}", e.what());
         return false;
@@ -1,6 +1,7 @@
 #pragma once
 #include <memory>
 #include <functional>
+#include <cstdint>
 
 // 前向声明, 减少头文件的依赖，增加编译速度
 struct SDL_Window;
@@ -37,6 +38,7 @@ class Time;
 class Config;
 class Context;
 class GameState;
+class ThreadPool;
 
 /**
  * @brief 主游戏应用程序类，初始化SDL，管理游戏循环。
@@ -46,6 +48,8 @@ private:
     SDL_Window* window_ = nullptr;
     SDL_Renderer* sdl_renderer_ = nullptr;
     bool is_running_ = false;
+    bool show_physics_stats_ = false;   ///< @brief 是否显示物理统计调试信息 (按 toggle_physics_stats 动作切换)
+    std::uint64_t frame_heap_allocations_ = 0;  ///< @brief 上一帧的系统堆分配次数 (需启用 SUNNYLAND_TRACK_ALLOCATIONS)
 
     /// @brief 游戏场景设置函数，用于在运行游戏前设置初始场景 (GameApp不再决定初始场景是什么)
     std::function<void(engine::scene::SceneManager&)> scene_setup_func_;
@@ -57,6 +61,7 @@ private:
     std::unique_ptr<engine::render::Camera> camera_;
     std::unique_ptr<engine::render::TextRenderer> text_renderer_;
     std::unique_ptr<engine::core::Config> config_;
+    std::unique_ptr<engine::core::ThreadPool> thread_pool_;     ///< @brief 工作线程池 (需先于使用它的模块创建、后于它们销毁)
     std::unique_ptr<engine::input::InputManager> input_manager_;
     std::unique_ptr<engine::core::Context> context_;
     std::unique_ptr<engine::scene::SceneManager> scene_manager_;
@@ -91,6 +96,7 @@ private:
     void handleEvents();
     void update(float delta_time);
     void render();
+    void renderPhysicsStats();      ///< @brief 在屏幕左上角绘制物理引擎最近一帧的统计数据 (以及内存分配统计)
     void close();
 
     // 各模块的初始化/创建函数，在init()中调用
@@ -103,6 +109,7 @@ private:
     [[nodiscard]] bool initTextRenderer();
     [[nodiscard]] bool initCamera();
     [[nodiscard]] bool initInputManager();
+    [[nodiscard]] bool initThreadPool();
     [[nodiscard]] bool initPhysicsEngine();
     [[nodiscard]] bool initGameState();
     [[nodiscard]] bool initContext();
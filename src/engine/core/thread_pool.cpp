@@ -0,0 +1,94 @@
+#include "thread_pool.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace engine::core {
+
+ThreadPool::ThreadPool(std::size_t worker_count) {
+    if (worker_count == 0) {
+        auto hardware_threads = std::thread::hardware_concurrency();
+        worker_count = hardware_threads > 1 ? hardware_threads - 1 : 0;
+    }
+    workers_.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+    spdlog::trace("线程池创建完成，工作线程数: {}", worker_count);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) worker.join();
+    }
+    spdlog::trace("线程池已销毁。");
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t min_batch_size,
+                             engine::utils::FunctionRef<void(std::size_t, std::size_t)> func) {
+    if (count == 0) return;
+    min_batch_size = std::max<std::size_t>(min_batch_size, 1);
+    // 没有工作线程或数据量太小时，直接在调用线程执行，避免同步开销
+    if (workers_.empty() || count <= min_batch_size) {
+        func(0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit_lock(submit_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &func;
+        job_count_ = count;
+        // 每个线程大约领取4次，兼顾负载均衡与领取开销
+        auto thread_count = workers_.size() + 1;
+        batch_size_ = std::max(min_batch_size, (count + thread_count * 4 - 1) / (thread_count * 4));
+        next_index_.store(0, std::memory_order_relaxed);
+        busy_workers_ = workers_.size();
+        ++generation_;
+    }
+    work_cv_.notify_all();
+
+    // 调用线程同样参与计算
+    runBatches();
+
+    // 等待所有工作线程完成当前任务
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return busy_workers_ == 0; });
+    job_ = nullptr;
+}
+
+void ThreadPool::workerLoop() {
+    std::uint64_t seen_generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_cv_.wait(lock, [this, &seen_generation]() { return stop_ || generation_ != seen_generation; });
+            if (stop_) return;
+            seen_generation = generation_;
+        }
+
+        runBatches();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_workers_ == 0) {
+                done_cv_.notify_one();
+            }
+        }
+    }
+}
+
+void ThreadPool::runBatches() {
+    while (true) {
+        auto begin = next_index_.fetch_add(batch_size_, std::memory_order_relaxed);
+        if (begin >= job_count_) break;
+        auto end = std::min(begin + batch_size_, job_count_);
+        (*job_)(begin, end);
+    }
+}
+
+} // namespace engine::core
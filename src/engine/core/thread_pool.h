@@ -0,0 +1,66 @@
+#pragma once
+#include "../utils/function_ref.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::core {
+
+/**
+ * @brief 固定数量工作线程的线程池，提供数据并行的 parallelFor。
+ *
+ * 调用线程也会参与计算，并在所有分块完成后才返回，因此回调中可以安全地引用调用者的局部变量。
+ * @note parallelFor 不可重入（不要在回调中再次调用），回调中只应写入互不重叠的数据。
+ */
+class ThreadPool final {
+private:
+    std::vector<std::thread> workers_;          ///< @brief 工作线程
+    std::mutex mutex_;                          ///< @brief 保护任务状态
+    std::mutex submit_mutex_;                   ///< @brief 保证同一时间只有一个 parallelFor 在执行
+    std::condition_variable work_cv_;           ///< @brief 通知工作线程有新任务
+    std::condition_variable done_cv_;           ///< @brief 通知调用线程任务已完成
+
+    // --- 当前任务 ---
+    const engine::utils::FunctionRef<void(std::size_t, std::size_t)>* job_ = nullptr;  ///< @brief 当前任务回调 (begin, end)
+    std::size_t job_count_ = 0;                 ///< @brief 当前任务的元素总数
+    std::size_t batch_size_ = 1;                ///< @brief 每次领取的元素数量
+    std::atomic<std::size_t> next_index_ = 0;   ///< @brief 下一个待领取的元素序号
+    std::size_t busy_workers_ = 0;              ///< @brief 尚未完成当前任务的工作线程数
+    std::uint64_t generation_ = 0;              ///< @brief 任务代数，用于唤醒工作线程
+    bool stop_ = false;                         ///< @brief 是否停止线程池
+
+public:
+    /**
+     * @brief 构造函数
+     * @param worker_count 工作线程数量。0 表示自动（硬件线程数 - 1，调用线程也参与计算）。
+     */
+    explicit ThreadPool(std::size_t worker_count = 0);
+    ~ThreadPool();
+
+    // 禁止拷贝和移动
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /**
+     * @brief 将 [0, count) 分块后并行执行，阻塞直到全部完成。
+     * @param count 元素总数
+     * @param min_batch_size 每个分块的最少元素数，元素数不超过此值时直接在调用线程执行
+     * @param func 回调，参数为分块的 [begin, end)
+     */
+    void parallelFor(std::size_t count, std::size_t min_batch_size,
+                     engine::utils::FunctionRef<void(std::size_t, std::size_t)> func);
+
+    std::size_t getWorkerCount() const { return workers_.size(); }     ///< @brief 获取工作线程数量（不含调用线程）
+
+private:
+    void workerLoop();      ///< @brief 工作线程主循环
+    void runBatches();      ///< @brief 领取并执行当前任务的分块，直到没有剩余
+};
+
+} // namespace engine::core
@@ -21,6 +21,10 @@ void Time::update() {
     } else {
         delta_time_ = current_delta_time;
     }
+    // 确定性模式：逻辑帧按固定时间推进，与实际耗时无关
+    if (fixed_delta_time_ > 0.0) {
+        delta_time_ = fixed_delta_time_;
+    }
 
     last_time_ = SDL_GetTicksNS(); // 记录离开 update 时的时间戳
 }
@@ -79,4 +83,15 @@ int Time::getTargetFps() const {
     return target_fps_;
 }
 
+void Time::setFixedDeltaTime(double seconds) {
+    if (seconds < 0.0) {
+        spdlog::warn("Fixed delta time 不能为负。Setting to 0 (disabled).");
+        seconds = 0.0;
+    }
+    fixed_delta_time_ = seconds;
+    if (fixed_delta_time_ > 0.0) {
+        spdlog::info("Fixed delta time 设置为: {:.6f}s", fixed_delta_time_);
+    }
+}
+
 } // namespace engine::core 
\ No newline at end of file
@@ -19,6 +19,7 @@ private:
     // 帧率限制相关
     int target_fps_ = 0;             ///< @brief 目标 FPS (0 表示不限制)
     double target_frame_time_ = 0.0; ///< @brief 目标每帧时间 (秒)
+    double fixed_delta_time_ = 0.0;  ///< @brief 固定帧间时间差 (秒，0 表示使用实际测量值)
 
 public:
     Time();
@@ -77,6 +78,16 @@ public:
      */
     int getTargetFps() const;
 
+    /**
+     * @brief 设置固定的帧间时间差 (用于确定性模式)。
+     *
+     * @param seconds 大于 0 时，无论实际帧耗时多少，DeltaTime 都返回该值 (帧率限制仍然有效)；0 表示恢复使用实际测量值。
+     */
+    void setFixedDeltaTime(double seconds);
+
+    /** @brief 获取固定的帧间时间差，0 表示未启用。 */
+    double getFixedDeltaTime() const { return fixed_delta_time_; }
+
 private:
     /**
      * @brief update 中调用，用于限制帧率。如果设置了 target_fps_ > 0，且当前帧执行时间小于目标帧时间，则会调用 SDL_DelayNS() 来等待剩余时间。
@@ -2,41 +2,98 @@
 #include "../render/renderer.h"
 #include "../input/input_manager.h" 
 #include "../render/camera.h"
+#include "../scene/scene.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::object {
-GameObject::GameObject(std::string_view name, std::string_view tag): name_(name), tag_(tag)
+GameObject::GameObject(std::string_view name, std::string_view tag)
 {
+    auto& interner = engine::utils::StringInterner::global();
+    name_id_ = interner.intern(name);
+    name_ = interner.view(name_id_);
+    tag_id_ = interner.intern(tag);
+    tag_ = interner.view(tag_id_);
     spdlog::trace("GameObject created: {} {}", name_, tag_);
 }
 
+void GameObject::setName(std::string_view name) {
+    auto& interner = engine::utils::StringInterner::global();
+    auto name_id = interner.intern(name);
+    if (name_id == name_id_) return;
+    auto old_name_id = name_id_;
+    name_id_ = name_id;
+    name_ = interner.view(name_id);
+    if (scene_) scene_->onGameObjectRenamed(*this, old_name_id);
+}
+
+void GameObject::setTag(std::string_view tag) {
+    auto& interner = engine::utils::StringInterner::global();
+    tag_id_ = interner.intern(tag);
+    tag_ = interner.view(tag_id_);
+}
+
 void GameObject::update(float delta_time, engine::core::Context& context) {
-    // 遍历所有组件并调用它们的 update 方法
-    for (auto& pair : components_) {
-        pair.second->update(delta_time, context);
+    // 依次执行所有阶段 (场景通常按阶段跨对象调用 updatePhase，这里用于单独更新某个对象)
+    for (std::size_t i = 0; i < engine::component::UPDATE_PHASE_COUNT; ++i) {
+        updatePhase(static_cast<engine::component::UpdatePhase>(i), delta_time, context);
+    }
+}
+
+void GameObject::updatePhase(engine::component::UpdatePhase phase, float delta_time, engine::core::Context& context) {
+    // 按添加顺序遍历该阶段的组件并调用它们的 update 方法 (顺序固定，与组件类型ID无关)
+    auto end = phase_end_[static_cast<std::size_t>(phase)];
+    for (auto i = phaseBegin(phase); i < end; ++i) {
+        components_[update_order_[i]]->update(delta_time, context);
     }
 }
 
 void GameObject::render(engine::core::Context& context) {
-    // 遍历所有组件并调用它们的 render 方法
-    for (auto& pair : components_) {
-        pair.second->render(context);
+    // 按添加顺序遍历需要渲染的组件并调用它们的 render 方法
+    for (auto type_id : render_order_) {
+        components_[type_id]->render(context);
     }
 }
 
 void GameObject::clean() {
     spdlog::trace("Cleaning GameObject...");
-    // 遍历所有组件并调用它们的 clean 方法
-    for (auto& pair : components_) {
-        pair.second->clean();
+    // 按添加顺序遍历所有组件并调用它们的 clean 方法
+    for (auto type_id : component_order_) {
+        components_[type_id]->clean();
     }
-    components_.clear(); // 清空 map, unique_ptr 会自动释放内存
+    component_order_.clear();
+    update_order_.clear();
+    phase_end_.fill(0);
+    render_order_.clear();
+    for (auto& slot : components_) slot.reset();   // 释放所有槽位中的组件
 }
 
 void GameObject::handleInput(engine::core::Context& context) {
-    // 遍历所有组件并调用它们的 handleInput 方法
-    for (auto& pair : components_) {
-        pair.second->handleInput(context);
+    // 按添加顺序遍历所有组件并调用它们的 handleInput 方法
+    for (auto type_id : component_order_) {
+        components_[type_id]->handleInput(context);
+    }
+}
+
+void GameObject::addToPhase(std::uint8_t type_id, engine::component::UpdatePhase phase) {
+    // 插入到该阶段末尾，之后各阶段的范围整体后移一位 (每种类型最多一个组件，不会超出容量)
+    auto index = static_cast<std::size_t>(phase);
+    update_order_.insert(update_order_.begin() + phase_end_[index], type_id);
+    for (auto i = index; i < phase_end_.size(); ++i) ++phase_end_[i];
+}
+
+void GameObject::removeFromLists(std::uint8_t type_id, engine::component::UpdatePhase phase) {
+    if (auto it = std::find(component_order_.begin(), component_order_.end(), type_id); it != component_order_.end()) {
+        component_order_.erase(it);
+    }
+    if (auto it = std::find(render_order_.begin(), render_order_.end(), type_id); it != render_order_.end()) {
+        render_order_.erase(it);
+    }
+    auto index = static_cast<std::size_t>(phase);
+    auto begin = update_order_.begin() + phaseBegin(phase);
+    auto end = update_order_.begin() + phase_end_[index];
+    if (auto it = std::find(begin, end, type_id); it != end) {
+        update_order_.erase(it);
+        for (auto i = index; i < phase_end_.size(); ++i) --phase_end_[i];
     }
 }
 
@@ -1,9 +1,16 @@
 #pragma once
 #include "../component/component.h" 
+#include "../component/component_pool.h"
+#include "../utils/pool_allocator.h"
+#include "../utils/fixed_vector.h"
+#include "object_handle.h"
+#include "../utils/string_interner.h"
 #include <string_view>
 #include <memory>
-#include <unordered_map>
-#include <typeindex>        // 用于类型索引
+#include <array>
+#include <cstdint>
+#include <algorithm>
+#include <typeinfo>         // 用于日志中的类型名称
 #include <utility>          // 用于完美转发
 #include <spdlog/spdlog.h>
 
@@ -11,6 +18,10 @@ namespace engine::core {
     class Context;
 }
 
+namespace engine::scene {
+    class Scene;
+}
+
 namespace engine::object {
 
 /**
@@ -20,11 +31,34 @@ namespace engine::object {
  * 它还提供更新和渲染游戏对象的方法。
  */
 class GameObject final {
+    friend class engine::scene::Scene;      // 由场景分配/回收句柄、维护名称索引
 private:
-    std::string name_;          ///< @brief 名称
-    std::string tag_;           ///< @brief 标签
-    std::unordered_map<std::type_index, std::unique_ptr<engine::component::Component>> components_;  ///< @brief 组件列表
+    // 名称和标签都是驻留字符串：同名对象共享同一份内容，比较时可以直接比较ID
+    std::string_view name_;     ///< @brief 名称 (指向驻留池中的字符串)
+    std::string_view tag_;      ///< @brief 标签 (指向驻留池中的字符串)
+    engine::utils::StringId name_id_ = engine::utils::EMPTY_STRING_ID;  ///< @brief 名称ID
+    engine::utils::StringId tag_id_ = engine::utils::EMPTY_STRING_ID;   ///< @brief 标签ID
+    /// @brief 拥有组件的智能指针 (池化组件销毁时归还对象池)
+    using ComponentPtr = std::unique_ptr<engine::component::Component, engine::component::ComponentDeleter>;
+    /// @brief 组件槽位，以组件类型ID为下标 (每种类型最多一个组件)
+    std::array<ComponentPtr, engine::component::MAX_COMPONENT_TYPES> components_;
+    // 以下列表保存组件类型ID (components_ 的下标)：每种类型最多一个组件，定长数组足够容纳，创建对象时无需分配内存
+    static_assert(engine::component::MAX_COMPONENT_TYPES <= 256, "组件类型ID需要能用 uint8_t 保存");
+    using ComponentList = engine::utils::FixedVector<std::uint8_t, engine::component::MAX_COMPONENT_TYPES>;
+    ComponentList component_order_;     ///< @brief 按添加顺序排列的组件 (决定输入/清理顺序)
+    /// @brief 需要每帧 update 的组件，按更新阶段分组排列 (组内按添加顺序)，第 i 个阶段的组件位于 [phase_end_[i-1], phase_end_[i])
+    ComponentList update_order_;
+    std::array<std::uint8_t, engine::component::UPDATE_PHASE_COUNT> phase_end_{};
+    ComponentList render_order_;        ///< @brief 需要 render 的组件 (按添加顺序)
     bool need_remove_ = false;  ///< @brief 延迟删除的标识，将来由场景类负责删除
+    ObjectHandle handle_;       ///< @brief 所属场景分配的句柄 (尚未加入场景时无效)
+    engine::scene::Scene* scene_ = nullptr;     ///< @brief 已加入的场景 (用于改名时更新场景的名称索引)
+
+    // --- 活动区域 (由场景根据相机的活动区域维护) ---
+    bool always_active_ = false;    ///< @brief 是否总是更新 (不受活动区域影响)
+    bool active_ = true;            ///< @brief 是否在活动区域内 (区域外的对象被冻结或降频更新)
+    bool inactive_tick_ = false;    ///< @brief 区域外的对象本帧是否执行一次降频更新
+    float inactive_time_ = 0.0f;    ///< @brief 区域外的对象自上次更新以来累积的时间 (降频更新时作为帧间隔)
 
 public:
 
@@ -36,13 +70,23 @@ public:
     GameObject(GameObject&&) = delete;
     GameObject& operator=(GameObject&&) = delete;
 
+    // 游戏对象从尺寸分级的池分配器中分配 (特效、道具等会被频繁创建和销毁)
+    static void* operator new(std::size_t size) { return engine::utils::PoolAllocator::global().allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) noexcept { engine::utils::PoolAllocator::global().deallocate(ptr, size); }
+
     // setters and getters
-    void setName(std::string_view name) { name_ = name; }                 ///< @brief 设置名称
+    void setName(std::string_view name);                                  ///< @brief 设置名称 (已加入场景时同步更新场景的名称索引)
     std::string_view getName() const { return name_; }                    ///< @brief 获取名称
-    void setTag(std::string_view tag) { tag_ = tag; }                     ///< @brief 设置标签
+    engine::utils::StringId getNameId() const { return name_id_; }        ///< @brief 获取名称ID (驻留字符串ID)
+    void setTag(std::string_view tag);                                    ///< @brief 设置标签
     std::string_view getTag() const { return tag_; }                      ///< @brief 获取标签
+    engine::utils::StringId getTagId() const { return tag_id_; }          ///< @brief 获取标签ID (驻留字符串ID，用于快速比较)
     void setNeedRemove(bool need_remove) { need_remove_ = need_remove; }    ///< @brief 设置是否需要删除
     bool isNeedRemove() const { return need_remove_; }                      ///< @brief 获取是否需要删除
+    ObjectHandle getHandle() const { return handle_; }                      ///< @brief 获取句柄 (加入场景后有效)
+    void setAlwaysActive(bool always_active) { always_active_ = always_active; }    ///< @brief 设置是否总是更新 (不受活动区域剔除)
+    bool isAlwaysActive() const { return always_active_; }                  ///< @brief 是否总是更新
+    bool isActive() const { return active_; }                               ///< @brief 是否在活动区域内 (否则被冻结或降频更新)
 
     /**
      * @brief 添加组件 (里面会完成组件的init())
@@ -57,18 +101,27 @@ public:
         // 检测组件是否合法。  /*  static_assert(condition, message)：静态断言，在编译期检测，无任何性能影响 */
                             /* std::is_base_of<Base, Derived>::value -- 判断 Base 类型是否是 Derived 类型的基类 */
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        // 获取类型标识。     /* typeid(T) -- 用于获取一个表达式或类型的运行时类型信息 (RTTI), 返回 std::type_info& */
-                            /* std::type_index -- 针对std::type_info对象的包装器，主要设计用来作为关联容器（如 std::map）的键。*/
-        auto type_index = std::type_index(typeid(T));
+        // 获取类型ID (槽位下标)
+        auto type_id = engine::component::getComponentTypeId<T>();
         // 如果组件已经存在，则直接返回组件指针
-        if (hasComponent<T>()) {
-            return getComponent<T>();
+        if (components_[type_id]) {
+            return static_cast<T*>(components_[type_id].get());
+        }
+        // 如果不存在则创建组件 (热点组件从对象池分配)     /* std::forward -- 用于实现完美转发。传递多个参数的时候使用...标识 */
+        T* ptr = nullptr;
+        if constexpr (T::POOLED) {
+            ptr = engine::component::ComponentPool<T>::get().create(std::forward<Args>(args)...);
+            components_[type_id] = ComponentPtr(ptr, {&engine::component::destroyPooledComponent<T>});
+        } else {
+            ptr = new T(std::forward<Args>(args)...);
+            components_[type_id] = ComponentPtr(ptr, {});
         }
-        // 如果不存在则创建组件     /* std::forward -- 用于实现完美转发。传递多个参数的时候使用...标识 */
-        auto new_component = std::make_unique<T>(std::forward<Args>(args)...);
-        T* ptr = new_component.get();                               // 先获取裸指针以便返回
-        new_component->setOwner(this);                              // 设置组件的拥有者
-        components_[type_index] = std::move(new_component);         // 移动组件   （new_component 变为空，不可再使用）
+        ptr->setOwner(this);                                        // 设置组件的拥有者
+        auto id = static_cast<std::uint8_t>(type_id);
+        component_order_.push_back(id);                             // 记录添加顺序
+        static_assert(!T::SYSTEM_UPDATE || T::POOLED, "由系统更新的组件必须从对象池分配");
+        if constexpr (T::HAS_UPDATE && !T::SYSTEM_UPDATE) addToPhase(id, T::UPDATE_PHASE);  // 只有 update/render 有实际工作的组件才加入对应列表，
+        if constexpr (T::HAS_RENDER) render_order_.push_back(id);   // 省去每帧对空函数的虚调用
         ptr->init();                                                // 初始化组件 （因此必须用ptr而不能用new_component）
         spdlog::debug("GameObject::addComponent: {} added component {}", name_, typeid(T).name());
         return ptr;                                                 // 返回非拥有指针
@@ -83,13 +136,8 @@ public:
     template <typename T>
     T* getComponent() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        auto type_index = std::type_index(typeid(T));
-        auto it = components_.find(type_index);
-        if (it != components_.end()) {
-            // 返回unique_ptr的裸指针。(肯定是T类型, static_cast其实并无必要，但保留可以使我们意图更清晰)
-            return static_cast<T*>(it->second.get());
-        }
-        return nullptr;
+        // 直接按类型ID取槽位，无需哈希查找。(槽位中肯定是T类型，空槽位返回nullptr)
+        return static_cast<T*>(components_[engine::component::getComponentTypeId<T>()].get());
     }
 
     /**
@@ -101,8 +149,7 @@ public:
     template <typename T>
     bool hasComponent() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        // contains方法为 C++20 新增
-        return components_.contains(std::type_index(typeid(T)));
+        return components_[engine::component::getComponentTypeId<T>()] != nullptr;
     }
 
     /**
@@ -113,20 +160,34 @@ public:
     template <typename T>
     void removeComponent() {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        auto type_index = std::type_index(typeid(T));
-        auto it = components_.find(type_index);
-        if (it != components_.end()) {
-            it->second->clean();
-            components_.erase(it);
+        auto type_id = engine::component::getComponentTypeId<T>();
+        auto& slot = components_[type_id];
+        if (slot) {
+            slot->clean();
+            removeFromLists(static_cast<std::uint8_t>(type_id), T::UPDATE_PHASE);
+            slot.reset();
         }
     }
 
     // 关键循环函数
-    void update(float delta_time, engine::core::Context& context);              ///< @brief 更新所有组件
+    void update(float delta_time, engine::core::Context& context);              ///< @brief 按阶段顺序更新所有组件 (由场景系统更新的组件除外)
+    void updatePhase(engine::component::UpdatePhase phase, float delta_time, engine::core::Context& context);   ///< @brief 只更新指定阶段的组件
+    bool hasPhase(engine::component::UpdatePhase phase) const {                 ///< @brief 指定阶段是否有需要更新的组件
+        return phaseBegin(phase) != phase_end_[static_cast<std::size_t>(phase)];
+    }
     void render(engine::core::Context& context);                                ///< @brief 渲染所有组件
     void clean();                                                               ///< @brief 清理所有组件
     void handleInput(engine::core::Context& context);                           ///< @brief 处理输入
 
+private:
+    /// @brief 指定阶段的组件在 update_order_ 中的起始位置
+    std::size_t phaseBegin(engine::component::UpdatePhase phase) const {
+        auto index = static_cast<std::size_t>(phase);
+        return index == 0 ? 0 : phase_end_[index - 1];
+    }
+    void addToPhase(std::uint8_t type_id, engine::component::UpdatePhase phase);          ///< @brief 把组件加入指定阶段的末尾
+    void removeFromLists(std::uint8_t type_id, engine::component::UpdatePhase phase);     ///< @brief 把组件从所有列表中移除
+
 };
 
 } // namespace engine::object
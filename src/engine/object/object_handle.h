@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::object {
+
+/**
+ * @brief 游戏对象的代际句柄 (槽位序号 + 代数)。
+ *
+ * 由场景在添加对象时分配，通过 Scene::getGameObject() 解析。对象被移除后槽位的代数会改变，
+ * 旧句柄随之失效 (解析为 nullptr)，因此可以长期保存而不会悬空。
+ * 代数取自全局递增的计数器，不同场景分配的句柄也不会互相混淆。
+ */
+struct ObjectHandle {
+    static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;    ///< @brief 无效的槽位序号
+
+    std::uint32_t index = INVALID_INDEX;    ///< @brief 场景句柄表中的槽位序号
+    std::uint32_t generation = 0;           ///< @brief 分配时槽位的代数
+
+    bool isValid() const { return index != INVALID_INDEX; }    ///< @brief 是否曾被分配 (不代表对象仍然存在)
+    bool operator==(const ObjectHandle&) const = default;
+};
+
+} // namespace engine::object
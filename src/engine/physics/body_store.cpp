@@ -0,0 +1,115 @@
+#include "body_store.h"
+#include "collision_layer.h"
+#include "../component/physics_component.h"
+#include <utility>
+
+namespace engine::physics {
+
+namespace {
+    /// @brief 删除 vector 中指定序号的元素（用最后一个元素填补空位）
+    template<typename T>
+    void eraseAt(std::vector<T>& column, std::size_t index) {
+        if (index + 1 != column.size()) {
+            column[index] = std::move(column.back());
+        }
+        column.pop_back();
+    }
+}
+
+void BodyStore::add(engine::component::PhysicsComponent* pc,
+                    engine::component::TransformComponent* tc,
+                    engine::component::ColliderComponent* cc,
+                    engine::object::GameObject* owner) {
+    pc->setBodyIndex(size());
+    components.push_back(pc);
+    transforms.push_back(tc);
+    colliders.push_back(cc);
+    owners.push_back(owner);
+    position.emplace_back(0.0f, 0.0f);
+    previous_position.emplace_back(0.0f, 0.0f);
+    velocity.emplace_back(0.0f, 0.0f);
+    force.emplace_back(0.0f, 0.0f);
+    impulse.emplace_back(0.0f, 0.0f);
+    mass.push_back(1.0f);
+    aabb_offset.emplace_back(0.0f, 0.0f);
+    aabb_size.emplace_back(0.0f, 0.0f);
+    shape.push_back(ColliderType::NONE);
+    category.push_back(CollisionLayer::DEFAULT);
+    mask.push_back(CollisionLayer::ALL);
+    flags.push_back(0);
+    contact_flags.push_back(0);
+    tile_triggers.push_back(0);
+    reported_triggers.push_back(0);
+    sleeping.push_back(0);
+    sleep_timer.push_back(0.0f);
+    frozen.push_back(0);
+    catch_up_time.push_back(0.0f);
+}
+
+void BodyStore::removeAt(std::size_t index) {
+    if (index >= size()) return;
+    components[index]->setBodyIndex(engine::component::PhysicsComponent::NO_BODY_INDEX);
+    eraseAt(components, index);
+    if (index < size()) {
+        components[index]->setBodyIndex(index);     // 被移过来的物体
+    }
+    eraseAt(transforms, index);
+    eraseAt(colliders, index);
+    eraseAt(owners, index);
+    eraseAt(position, index);
+    eraseAt(previous_position, index);
+    eraseAt(velocity, index);
+    eraseAt(force, index);
+    eraseAt(impulse, index);
+    eraseAt(mass, index);
+    eraseAt(aabb_offset, index);
+    eraseAt(aabb_size, index);
+    eraseAt(shape, index);
+    eraseAt(category, index);
+    eraseAt(mask, index);
+    eraseAt(flags, index);
+    eraseAt(contact_flags, index);
+    eraseAt(tile_triggers, index);
+    eraseAt(reported_triggers, index);
+    eraseAt(sleeping, index);
+    eraseAt(sleep_timer, index);
+    eraseAt(frozen, index);
+    eraseAt(catch_up_time, index);
+}
+
+std::size_t BodyStore::indexOf(const engine::component::PhysicsComponent* pc) const {
+    if (!pc) return size();
+    auto index = pc->getBodyIndex();
+    return (index < size() && components[index] == pc) ? index : size();
+}
+
+void BodyStore::clear() {
+    for (auto* pc : components) {
+        pc->setBodyIndex(engine::component::PhysicsComponent::NO_BODY_INDEX);
+    }
+    components.clear();
+    transforms.clear();
+    colliders.clear();
+    owners.clear();
+    position.clear();
+    previous_position.clear();
+    velocity.clear();
+    force.clear();
+    impulse.clear();
+    mass.clear();
+    aabb_offset.clear();
+    aabb_size.clear();
+    shape.clear();
+    category.clear();
+    mask.clear();
+    flags.clear();
+    contact_flags.clear();
+    tile_triggers.clear();
+    reported_triggers.clear();
+    sleeping.clear();
+    sleep_timer.clear();
+    frozen.clear();
+    catch_up_time.clear();
+}
+
+} // namespace engine::physics
@@ -0,0 +1,89 @@
+#pragma once
+#include "collider.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <glm/vec2.hpp>
+
+namespace engine::component {
+    class PhysicsComponent;
+    class TransformComponent;
+    class ColliderComponent;
+}
+
+namespace engine::object {
+    class GameObject;
+}
+
+namespace engine::physics {
+
+/// @brief 物体状态标志（每步开始时从组件收集）
+namespace BodyFlag {
+    constexpr std::uint8_t ENABLED         = 1u << 0;   ///< @brief 物理组件启用
+    constexpr std::uint8_t USE_GRAVITY     = 1u << 1;   ///< @brief 受重力影响
+    constexpr std::uint8_t HAS_COLLIDER    = 1u << 2;   ///< @brief 拥有碰撞组件
+    constexpr std::uint8_t COLLIDER_ACTIVE = 1u << 3;   ///< @brief 碰撞组件激活
+    constexpr std::uint8_t TRIGGER         = 1u << 4;   ///< @brief 碰撞组件为触发器
+} // namespace BodyFlag
+
+/// @brief 碰撞状态标志（物理步骤中产生，步骤结束时写回 PhysicsComponent）
+namespace ContactFlag {
+    constexpr std::uint8_t BELOW         = 1u << 0;
+    constexpr std::uint8_t ABOVE         = 1u << 1;
+    constexpr std::uint8_t LEFT          = 1u << 2;
+    constexpr std::uint8_t RIGHT         = 1u << 3;
+    constexpr std::uint8_t ON_TOP_LADDER = 1u << 4;
+} // namespace ContactFlag
+
+/**
+ * @brief 以结构体数组（SoA）形式存储的物理物体表。
+ *
+ * 组件指针在注册时缓存，物理步骤开始时把组件状态收集到连续数组中，
+ * 积分、碰撞等计算只访问这些数组，步骤结束时再统一写回组件。
+ * 每个物理组件记录自己的序号，查找和移除都是 O(1)：移除时把最后一个物体移到空位并更新其序号。
+ * 物体顺序只取决于注册和移除的先后，因此遍历顺序仍是确定的。
+ */
+struct BodyStore {
+    // --- 缓存的组件指针 (非拥有) ---
+    std::vector<engine::component::PhysicsComponent*> components;
+    std::vector<engine::component::TransformComponent*> transforms;
+    std::vector<engine::component::ColliderComponent*> colliders;
+    std::vector<engine::object::GameObject*> owners;
+
+    // --- 物理状态 ---
+    std::vector<glm::vec2> position;        ///< @brief Transform 位置
+    std::vector<glm::vec2> previous_position;   ///< @brief 上一个物理子步开始时的位置 (用于渲染插值)
+    std::vector<glm::vec2> velocity;        ///< @brief 速度
+    std::vector<glm::vec2> force;           ///< @brief 本步受到的力
+    std::vector<glm::vec2> impulse;         ///< @brief 待施加的冲量 (固定步长模式下每帧的力 × 帧时间，在下一个子步一次性施加)
+    std::vector<float> mass;                ///< @brief 质量
+    std::vector<glm::vec2> aabb_offset;     ///< @brief 世界AABB左上角相对 Transform 位置的偏移
+    std::vector<glm::vec2> aabb_size;       ///< @brief 世界AABB尺寸 (已乘以缩放)
+    std::vector<ColliderType> shape;        ///< @brief 碰撞器形状
+    std::vector<std::uint32_t> category;    ///< @brief 碰撞类别
+    std::vector<std::uint32_t> mask;        ///< @brief 碰撞掩码
+    std::vector<std::uint8_t> flags;        ///< @brief BodyFlag 组合
+    std::vector<std::uint8_t> contact_flags;    ///< @brief ContactFlag 组合
+    std::vector<std::uint8_t> tile_triggers;    ///< @brief 当前覆盖的瓦片触发器 (TileTrigger 掩码)
+    std::vector<std::uint8_t> reported_triggers;    ///< @brief 上一次产生事件时的瓦片触发器掩码
+
+    // --- 休眠状态 ---
+    std::vector<std::uint8_t> sleeping;     ///< @brief 是否休眠 (休眠物体跳过积分、瓦片碰撞和写回)
+    std::vector<float> sleep_timer;         ///< @brief 持续静止的时间 (秒)
+    std::vector<std::uint8_t> frozen;       ///< @brief 是否被冻结 (离开活动区域，视为休眠且不会被接触唤醒)
+    std::vector<float> catch_up_time;       ///< @brief 待补上的模拟时间 (每个物理步骤中按步长额外模拟若干次，不足一步的部分留到之后)
+
+    std::size_t size() const { return components.size(); }     ///< @brief 物体数量
+
+    /// @brief 添加一个物体（组件指针由调用者提供），状态数组填入默认值
+    void add(engine::component::PhysicsComponent* pc,
+             engine::component::TransformComponent* tc,
+             engine::component::ColliderComponent* cc,
+             engine::object::GameObject* owner);
+    void removeAt(std::size_t index);       ///< @brief 移除指定序号的物体（最后一个物体移到该位置）
+    /// @brief 获取物理组件对应的序号 (读取组件记录的序号)，未注册时返回 size()
+    std::size_t indexOf(const engine::component::PhysicsComponent* pc) const;
+    void clear();                           ///< @brief 清空所有物体
+};
+
+} // namespace engine::physics
@@ -1,6 +1,16 @@
 #include "collision.h"
 #include "../component/collider_component.h"
 #include "../component/transform_component.h"
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <bit>
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENGINE_COLLISION_SSE2
+#endif
 
 namespace engine::physics::collision {
 
@@ -11,22 +21,30 @@ bool checkCollision(const engine::component::ColliderComponent& a, const engine:
     auto a_transform = a.getTransform();
     auto b_transform = b.getTransform();
 
-    // 先计算最小包围盒是否碰撞，如果没有碰撞，那一定是返回false (不考虑AABB的旋转)
     auto a_size = a_collider->getAABBSize() * a_transform->getScale();
     auto b_size = b_collider->getAABBSize() * b_transform->getScale();
     auto a_pos = a_transform->getPosition() + a.getOffset();
     auto b_pos = b_transform->getPosition() + b.getOffset();
+    return checkCollision(a_collider->getType(), {a_pos, a_size}, b_collider->getType(), {b_pos, b_size});
+}
+
+bool checkCollision(ColliderType a_type, const engine::utils::Rect& a_aabb, ColliderType b_type, const engine::utils::Rect& b_aabb) {
+    const auto& a_pos = a_aabb.position;
+    const auto& a_size = a_aabb.size;
+    const auto& b_pos = b_aabb.position;
+    const auto& b_size = b_aabb.size;
+    // 先计算最小包围盒是否碰撞，如果没有碰撞，那一定是返回false (不考虑AABB的旋转)
     if (!checkAABBOverlap(a_pos, a_size, b_pos, b_size)) {
         return false;
     }
 
     // --- 如果最小包围盒有碰撞，再进行更细致的判断 ---
     // AABB vs AABB, 直接返回真
-    if (a_collider->getType() == engine::physics::ColliderType::AABB && b_collider->getType() == engine::physics::ColliderType::AABB) {
+    if (a_type == engine::physics::ColliderType::AABB && b_type == engine::physics::ColliderType::AABB) {
         return true;
     }
     // Circle vs Circle: 判断两个圆心距离是否小于两个圆的半径之和
-    else if (a_collider->getType() == engine::physics::ColliderType::CIRCLE && b_collider->getType() == engine::physics::ColliderType::CIRCLE)
+    else if (a_type == engine::physics::ColliderType::CIRCLE && b_type == engine::physics::ColliderType::CIRCLE)
     {
         auto a_center = a_pos + 0.5f * a_size;  // 圆心位置
         auto b_center = b_pos + 0.5f * b_size;
@@ -35,7 +53,7 @@ bool checkCollision(const engine::component::ColliderComponent& a, const engine:
         return checkCircleOverlap(a_center, a_radius, b_center, b_radius);
     }
     // AABB vs Circle: 判断圆心到AABB的最邻近点是否在圆内
-    else if (a_collider->getType() == engine::physics::ColliderType::AABB && b_collider->getType() == engine::physics::ColliderType::CIRCLE)
+    else if (a_type == engine::physics::ColliderType::AABB && b_type == engine::physics::ColliderType::CIRCLE)
     {
         auto b_center = b_pos + 0.5f * b_size;
         auto b_radius = 0.5f * b_size.x;
@@ -43,7 +61,7 @@ bool checkCollision(const engine::component::ColliderComponent& a, const engine:
         return checkPointInCircle(nearest_point, b_center, b_radius);
     }
     // Circle vs AABB
-    else if (a_collider->getType() == engine::physics::ColliderType::CIRCLE && b_collider->getType() == engine::physics::ColliderType::AABB)
+    else if (a_type == engine::physics::ColliderType::CIRCLE && b_type == engine::physics::ColliderType::AABB)
     {
         auto a_center = a_pos + 0.5f * a_size;
         auto a_radius = 0.5f * a_size.x;
@@ -76,4 +94,154 @@ bool checkPointInCircle(const glm::vec2 &point, const glm::vec2 &center, const f
     return (glm::length(point - center) < radius);
 }
 
+std::optional<SweepHit> sweepAABB(const engine::utils::Rect& moving, const glm::vec2& motion, const engine::utils::Rect& target) {
+    // 分别计算两个轴上进入和离开目标区间的时刻，进入时刻取较大者、离开时刻取较小者
+    float entry_time = -std::numeric_limits<float>::infinity();
+    float exit_time = std::numeric_limits<float>::infinity();
+    glm::vec2 normal = {0.0f, 0.0f};
+    for (int axis = 0; axis < 2; ++axis) {
+        auto moving_min = moving.position[axis];
+        auto moving_max = moving.position[axis] + moving.size[axis];
+        auto target_min = target.position[axis];
+        auto target_max = target.position[axis] + target.size[axis];
+        if (motion[axis] == 0.0f) {
+            // 该轴上没有移动：必须一直处于重叠状态，否则永远不会接触
+            if (moving_max <= target_min || moving_min >= target_max) return std::nullopt;
+            continue;
+        }
+        auto axis_entry = motion[axis] > 0.0f ? (target_min - moving_max) / motion[axis] : (target_max - moving_min) / motion[axis];
+        auto axis_exit = motion[axis] > 0.0f ? (target_max - moving_min) / motion[axis] : (target_min - moving_max) / motion[axis];
+        if (axis_entry > entry_time) {
+            entry_time = axis_entry;
+            normal = {0.0f, 0.0f};
+            normal[axis] = motion[axis] > 0.0f ? -1.0f : 1.0f;
+        }
+        exit_time = std::min(exit_time, axis_exit);
+    }
+    // 起始时已重叠 (entry < 0)、本段位移内到不了 (entry > 1) 或者不会同时在两个轴上重叠，都不算扫掠碰撞
+    if (entry_time < 0.0f || entry_time > 1.0f || entry_time >= exit_time) return std::nullopt;
+    return SweepHit{entry_time, normal};
+}
+
+bool clipRay(const glm::vec2& origin, const glm::vec2& direction, const engine::utils::Rect& bounds, float& t_min, float& t_max) {
+    for (int axis = 0; axis < 2; ++axis) {
+        auto min = bounds.position[axis];
+        auto max = bounds.position[axis] + bounds.size[axis];
+        if (direction[axis] == 0.0f) {
+            // 平行于该轴：起点必须在区域的这一轴范围内
+            if (origin[axis] < min || origin[axis] > max) return false;
+            continue;
+        }
+        auto t0 = (min - origin[axis]) / direction[axis];
+        auto t1 = (max - origin[axis]) / direction[axis];
+        if (t0 > t1) std::swap(t0, t1);
+        t_min = std::max(t_min, t0);
+        t_max = std::min(t_max, t1);
+        if (t_min > t_max) return false;
+    }
+    return true;
+}
+
+void traverseGrid(const glm::vec2& origin, const glm::vec2& direction, float max_distance, const glm::vec2& cell_size,
+                  engine::utils::FunctionRef<bool(const GridCellVisit&)> visit) {
+    constexpr float infinity = std::numeric_limits<float>::infinity();
+    if (!std::isfinite(max_distance)) return;
+    // 超大坐标钳制后再转换为整数，避免溢出
+    auto to_cell = [](float coord, float size) {
+        constexpr float limit = static_cast<float>(1 << 30);
+        auto cell = std::floor(coord / size);
+        return std::isnan(cell) ? 0 : static_cast<int>(std::clamp(cell, -limit, limit));
+    };
+    glm::ivec2 cell = {to_cell(origin.x, cell_size.x), to_cell(origin.y, cell_size.y)};
+    glm::ivec2 step = {direction.x > 0.0f ? 1 : (direction.x < 0.0f ? -1 : 0),
+                       direction.y > 0.0f ? 1 : (direction.y < 0.0f ? -1 : 0)};
+    // t_max: 到达下一条竖直/水平网格线时走过的距离；t_delta: 穿过一整个单元格需要走过的距离
+    glm::vec2 t_max = {infinity, infinity};
+    glm::vec2 t_delta = {infinity, infinity};
+    for (int axis = 0; axis < 2; ++axis) {
+        if (step[axis] == 0) continue;
+        auto boundary = (cell[axis] + (step[axis] > 0 ? 1 : 0)) * cell_size[axis];
+        t_max[axis] = (boundary - origin[axis]) / direction[axis];
+        t_delta[axis] = cell_size[axis] / std::abs(direction[axis]);
+    }
+
+    float t_enter = 0.0f;
+    glm::vec2 normal = {0.0f, 0.0f};
+    while (t_enter <= max_distance) {
+        if (!visit({cell, t_enter, std::min(t_max.x, t_max.y), normal})) return;
+        if (t_max.x < t_max.y) {
+            t_enter = t_max.x;
+            t_max.x += t_delta.x;
+            cell.x += step.x;
+            normal = {static_cast<float>(-step.x), 0.0f};
+        } else {
+            if (step.y == 0) return;    // 零向量方向，没有更多单元格
+            t_enter = t_max.y;
+            t_max.y += t_delta.y;
+            cell.y += step.y;
+            normal = {0.0f, static_cast<float>(-step.y)};
+        }
+    }
+}
+
+void checkCollisionBatch(ColliderType type, const engine::utils::Rect& aabb, const ColliderBatch& batch,
+                         std::vector<std::uint64_t>& out_hits) {
+    const auto count = batch.size();
+    out_hits.assign((count + 63) / 64, 0);
+    const float q_min_x = aabb.position.x;
+    const float q_min_y = aabb.position.y;
+    const float q_max_x = aabb.position.x + aabb.size.x;
+    const float q_max_y = aabb.position.y + aabb.size.y;
+
+    // --- 第一步：AABB 重叠测试 (与 checkAABBOverlap 相同的严格不等式) ---
+    std::size_t i = 0;
+#if defined(__AVX__)
+    {
+        const auto qx0 = _mm256_set1_ps(q_min_x), qy0 = _mm256_set1_ps(q_min_y);
+        const auto qx1 = _mm256_set1_ps(q_max_x), qy1 = _mm256_set1_ps(q_max_y);
+        for (; i + 8 <= count; i += 8) {
+            auto hit = _mm256_and_ps(
+                _mm256_and_ps(_mm256_cmp_ps(qx1, _mm256_loadu_ps(&batch.min_x[i]), _CMP_GT_OQ),
+                              _mm256_cmp_ps(qx0, _mm256_loadu_ps(&batch.max_x[i]), _CMP_LT_OQ)),
+                _mm256_and_ps(_mm256_cmp_ps(qy1, _mm256_loadu_ps(&batch.min_y[i]), _CMP_GT_OQ),
+                              _mm256_cmp_ps(qy0, _mm256_loadu_ps(&batch.max_y[i]), _CMP_LT_OQ)));
+            // i 是8的倍数，8位结果不会跨越两个64位字
+            out_hits[i >> 6] |= static_cast<std::uint64_t>(_mm256_movemask_ps(hit)) << (i & 63);
+        }
+    }
+#elif defined(ENGINE_COLLISION_SSE2)
+    {
+        const auto qx0 = _mm_set1_ps(q_min_x), qy0 = _mm_set1_ps(q_min_y);
+        const auto qx1 = _mm_set1_ps(q_max_x), qy1 = _mm_set1_ps(q_max_y);
+        for (; i + 4 <= count; i += 4) {
+            auto hit = _mm_and_ps(
+                _mm_and_ps(_mm_cmpgt_ps(qx1, _mm_loadu_ps(&batch.min_x[i])), _mm_cmplt_ps(qx0, _mm_loadu_ps(&batch.max_x[i]))),
+                _mm_and_ps(_mm_cmpgt_ps(qy1, _mm_loadu_ps(&batch.min_y[i])), _mm_cmplt_ps(qy0, _mm_loadu_ps(&batch.max_y[i]))));
+            // i 是4的倍数，4位结果不会跨越两个64位字
+            out_hits[i >> 6] |= static_cast<std::uint64_t>(_mm_movemask_ps(hit)) << (i & 63);
+        }
+    }
+#endif
+    // 剩余不足一组的候选 (或不支持 SIMD 时的全部候选) 使用标量检测
+    for (; i < count; ++i) {
+        if (q_max_x > batch.min_x[i] && q_min_x < batch.max_x[i] && q_max_y > batch.min_y[i] && q_min_y < batch.max_y[i]) {
+            out_hits[i >> 6] |= std::uint64_t{1} << (i & 63);
+        }
+    }
+
+    // --- 第二步：涉及非 AABB 形状的命中，逐个做精确检测 ---
+    if (type == ColliderType::AABB && batch.all_aabb) return;
+    for (std::size_t word = 0; word < out_hits.size(); ++word) {
+        auto bits = out_hits[word];
+        while (bits) {
+            auto bit = static_cast<std::size_t>(std::countr_zero(bits));
+            bits &= bits - 1;
+            auto index = word * 64 + bit;
+            if (!checkCollision(type, aabb, batch.types[index], batch.rects[index])) {
+                out_hits[word] &= ~(std::uint64_t{1} << bit);
+            }
+        }
+    }
+}
+
 } // namespace engine::physics::collision 
\ No newline at end of file
@@ -1,5 +1,11 @@
 #pragma once
+#include "collider.h"
 #include "../utils/math.h"
+#include "../utils/function_ref.h"
+#include <optional>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
 
 namespace engine::component {
 class ColliderComponent;
@@ -15,6 +21,16 @@ namespace engine::physics::collision {
  */
 bool checkCollision(const engine::component::ColliderComponent& a, const engine::component::ColliderComponent& b);
 
+/**
+ * @brief 根据碰撞器形状和世界坐标下的最小包围盒，检查两个碰撞器是否重叠。（不依赖组件，供物理引擎批量检测使用）
+ * @param a_type 第一个碰撞器的形状。
+ * @param a_aabb 第一个碰撞器的世界AABB。
+ * @param b_type 第二个碰撞器的形状。
+ * @param b_aabb 第二个碰撞器的世界AABB。
+ * @return true 如果碰撞器重叠，否则为 false。
+ */
+bool checkCollision(ColliderType a_type, const engine::utils::Rect& a_aabb, ColliderType b_type, const engine::utils::Rect& b_aabb);
+
 /**
  * @brief 检查两个圆形是否重叠。
  * 
@@ -55,6 +71,100 @@ bool checkRectOverlap(const engine::utils::Rect& a, const engine::utils::Rect& b
  */
 bool checkPointInCircle(const glm::vec2& point, const glm::vec2& center, const float radius);
 
+/**
+ * @brief 批量检测所用的候选碰撞器，按 SoA 排列 (各分量连续存放，便于 SIMD 一次加载多个候选)。
+ * 容器可跨帧复用，clear() 不释放容量。
+ */
+struct ColliderBatch {
+    std::vector<float> min_x;               ///< @brief AABB 左边界
+    std::vector<float> min_y;               ///< @brief AABB 上边界
+    std::vector<float> max_x;               ///< @brief AABB 右边界
+    std::vector<float> max_y;               ///< @brief AABB 下边界
+    std::vector<ColliderType> types;        ///< @brief 碰撞器形状
+    std::vector<engine::utils::Rect> rects; ///< @brief 原始AABB (精确检测时使用，避免由边界还原尺寸带来的舍入误差)
+    bool all_aabb = true;                   ///< @brief 是否全部为 AABB (是则不需要逐个精确检测)
+
+    void clear() {
+        min_x.clear(); min_y.clear(); max_x.clear(); max_y.clear(); types.clear(); rects.clear();
+        all_aabb = true;
+    }
+    void add(ColliderType type, const engine::utils::Rect& aabb) {
+        min_x.push_back(aabb.position.x);
+        min_y.push_back(aabb.position.y);
+        max_x.push_back(aabb.position.x + aabb.size.x);
+        max_y.push_back(aabb.position.y + aabb.size.y);
+        types.push_back(type);
+        rects.push_back(aabb);
+        all_aabb = all_aabb && type == ColliderType::AABB;
+    }
+    std::size_t size() const { return types.size(); }
+};
+
+/**
+ * @brief 批量检测：一个碰撞器与一组候选碰撞器逐一检测，结果与逐对调用 checkCollision 相同。
+ *
+ * AABB 重叠测试使用 SIMD 一次处理多个候选 (AVX 8个 / SSE2 4个，不支持时退回标量)，
+ * 只有涉及圆形的命中才逐个做精确检测。
+ * @param type 碰撞器的形状。
+ * @param aabb 碰撞器的世界AABB。
+ * @param batch 候选碰撞器。
+ * @param out_hits 输出的命中位掩码，第 i 位对应第 i 个候选 (容器会被调整为 ceil(size / 64) 个元素)。
+ */
+void checkCollisionBatch(ColliderType type, const engine::utils::Rect& aabb, const ColliderBatch& batch,
+                         std::vector<std::uint64_t>& out_hits);
+
+/// @brief 读取命中位掩码中第 index 位
+inline bool testHit(const std::vector<std::uint64_t>& hits, std::size_t index) {
+    return (hits[index >> 6] >> (index & 63)) & 1u;
+}
+
+/// @brief 扫掠检测的结果
+struct SweepHit {
+    float time;         ///< @brief 碰撞时刻，占整段位移的比例 [0, 1]
+    glm::vec2 normal;   ///< @brief 碰撞面的法线 (指向移动物体一侧，只会是轴向单位向量)
+};
+
+/**
+ * @brief 扫掠AABB检测：计算移动的AABB沿位移方向第一次接触静止AABB的时刻 (分离轴 slab 方法)。
+ * @param moving 移动AABB的起始位置。
+ * @param motion 移动AABB的位移。
+ * @param target 静止的AABB。
+ * @return 在位移范围内发生接触时返回碰撞结果；起始时已经重叠、或者不会接触时返回空。
+ */
+std::optional<SweepHit> sweepAABB(const engine::utils::Rect& moving, const glm::vec2& motion, const engine::utils::Rect& target);
+
+/// @brief 网格遍历时访问的单元格信息
+struct GridCellVisit {
+    glm::ivec2 cell;    ///< @brief 单元格坐标
+    float t_enter;      ///< @brief 射线进入该单元格时走过的距离
+    float t_exit;       ///< @brief 射线离开该单元格时走过的距离
+    glm::vec2 normal;   ///< @brief 进入该单元格时穿过的边的法线 (起点所在单元格为零向量)
+};
+
+/**
+ * @brief 把射线裁剪到区域之内 (slab 方法)。
+ * @param origin 射线起点。
+ * @param direction 射线方向 (单位向量)。
+ * @param bounds 裁剪区域。
+ * @param t_min 输入输出：射线段的起始距离。
+ * @param t_max 输入输出：射线段的结束距离。
+ * @return 射线段与区域相交时返回 true，并把 [t_min, t_max] 缩小到区域之内。
+ */
+bool clipRay(const glm::vec2& origin, const glm::vec2& direction, const engine::utils::Rect& bounds, float& t_min, float& t_max);
+
+/**
+ * @brief 按顺序遍历射线经过的所有网格单元格 (Amanatides-Woo DDA)。
+ *
+ * 遍历的单元格数与距离成正比，超长射线应先用 clipRay 裁剪到网格范围内。单元格坐标钳制在 ±2^30 之内。
+ * @param origin 射线起点。
+ * @param direction 射线方向 (单位向量)。
+ * @param max_distance 最大距离 (必须为有限值)。
+ * @param cell_size 单元格尺寸。
+ * @param visit 回调，返回 false 时停止遍历。
+ */
+void traverseGrid(const glm::vec2& origin, const glm::vec2& direction, float max_distance, const glm::vec2& cell_size,
+                  engine::utils::FunctionRef<bool(const GridCellVisit&)> visit);
+
 // 未来可以添加更多碰撞检测相关的函数，
 
 } // namespace engine::physics::collision
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "collision_grid.h"
+#include "../component/tilelayer_component.h"
+#include <glm/common.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::physics {
+
+void CollisionGrid::rebuild(const std::vector<engine::component::TileLayerComponent*>& layers) {
+    using engine::component::TileType;
+
+    // 确定瓦片尺寸（第一个有效层）和网格尺寸（所有同尺寸层的最大值）
+    tile_size_ = {0, 0};
+    map_size_ = {0, 0};
+    for (const auto* layer : layers) {
+        if (!layer || layer->getTileSize().x <= 0 || layer->getTileSize().y <= 0) continue;
+        if (tile_size_.x == 0) {
+            tile_size_ = layer->getTileSize();
+        } else if (layer->getTileSize() != tile_size_) {
+            continue;
+        }
+        map_size_ = glm::max(map_size_, layer->getMapSize());
+    }
+
+    stride_ = map_size_.x + 2;
+    cells_.assign(static_cast<std::size_t>(stride_) * static_cast<std::size_t>(map_size_.y + 2), 0);
+    has_layers_ = false;
+
+    for (const auto* layer : layers) {
+        if (!layer || tile_size_.x == 0) continue;
+        if (layer->getTileSize() != tile_size_) {
+            spdlog::warn("CollisionGrid: 瓦片层尺寸 ({}, {}) 与碰撞网格 ({}, {}) 不一致，已忽略该层。",
+                layer->getTileSize().x, layer->getTileSize().y, tile_size_.x, tile_size_.y);
+            continue;
+        }
+        has_layers_ = true;
+
+        const auto& tiles = layer->getTiles();
+        auto layer_size = layer->getMapSize();
+        for (int y = 0; y < layer_size.y; ++y) {
+            for (int x = 0; x < layer_size.x; ++x) {
+                auto index = static_cast<std::size_t>(y) * static_cast<std::size_t>(layer_size.x) + static_cast<std::size_t>(x);
+                if (index >= tiles.size()) continue;
+                auto type = tiles[index].type;
+                if (type == TileType::EMPTY) continue;
+
+                auto& cell = cells_[static_cast<std::size_t>(y + 1) * static_cast<std::size_t>(stride_) + static_cast<std::size_t>(x + 1)];
+                auto current = static_cast<TileType>(cell & TYPE_MASK);
+                if (collisionPriority(type) > collisionPriority(current)) {
+                    cell = static_cast<std::uint16_t>((cell & ~TYPE_MASK) | static_cast<std::uint16_t>(type));
+                }
+                if (type == TileType::HAZARD) cell |= TRIGGER_HAZARD;
+                if (type == TileType::LADDER) cell |= TRIGGER_LADDER;
+            }
+        }
+    }
+    spdlog::trace("碰撞网格构建完成，尺寸: {}x{}", map_size_.x, map_size_.y);
+}
+
+int CollisionGrid::collisionPriority(engine::component::TileType type) {
+    using engine::component::TileType;
+    switch (type) {
+        case TileType::SOLID:       return 5;
+        case TileType::UNISOLID:    return 4;
+        case TileType::SLOPE_0_1:
+        case TileType::SLOPE_1_0:
+        case TileType::SLOPE_0_2:
+        case TileType::SLOPE_2_1:
+        case TileType::SLOPE_1_2:
+        case TileType::SLOPE_2_0:   return 3;
+        case TileType::LADDER:      return 2;
+        case TileType::HAZARD:
+        case TileType::NORMAL:      return 1;
+        default:                    return 0;
+    }
+}
+
+} // namespace engine::physics
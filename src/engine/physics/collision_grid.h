@@ -0,0 +1,69 @@
+#pragma once
+#include "tile_trigger.h"
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <glm/vec2.hpp>
+
+namespace engine::component {
+    class TileLayerComponent;
+    enum class TileType;
+}
+
+namespace engine::physics {
+
+/**
+ * @brief 由所有碰撞瓦片层合并而成的紧凑碰撞网格。
+ *
+ * 每个单元格用16位表示：低8位为合并后的 TileType（按碰撞优先级取最高者），
+ * 高8位为触发器标志（TileTrigger 掩码左移8位），即使该格的碰撞类型被其它层覆盖也不会丢失。
+ * 网格四周各有一圈空白边框，越界坐标会被钳制到边框上，因此查询既无分支跳转也不会输出日志。
+ */
+class CollisionGrid final {
+public:
+    static constexpr std::uint16_t TYPE_MASK      = 0x00FFu;    ///< @brief 低8位：TileType
+    static constexpr int TRIGGER_SHIFT = 8;                     ///< @brief 触发器标志在单元格中的偏移
+    static constexpr std::uint16_t TRIGGER_HAZARD = TileTrigger::HAZARD << TRIGGER_SHIFT;   ///< @brief 该格存在危险瓦片
+    static constexpr std::uint16_t TRIGGER_LADDER = TileTrigger::LADDER << TRIGGER_SHIFT;   ///< @brief 该格存在梯子瓦片
+
+private:
+    glm::ivec2 tile_size_ = {0, 0};     ///< @brief 瓦片尺寸（像素）
+    glm::ivec2 map_size_ = {0, 0};      ///< @brief 网格尺寸（瓦片数，不含边框）
+    int stride_ = 2;                    ///< @brief 每行单元格数（含边框）
+    std::vector<std::uint16_t> cells_ = std::vector<std::uint16_t>(4, 0);  ///< @brief 单元格数据（含边框，行主序）
+    bool has_layers_ = false;           ///< @brief 是否合并了至少一个瓦片层
+
+public:
+    CollisionGrid() = default;
+
+    /**
+     * @brief 根据瓦片层重新构建网格。
+     * @param layers 碰撞瓦片层。瓦片尺寸以第一个有效层为准，尺寸不同的层会被忽略并输出警告。
+     */
+    void rebuild(const std::vector<engine::component::TileLayerComponent*>& layers);
+
+    /// @brief 获取单元格数据（越界时返回边框的空白单元格）
+    std::uint16_t getCell(int x, int y) const {
+        x = std::clamp(x, -1, map_size_.x);
+        y = std::clamp(y, -1, map_size_.y);
+        return cells_[static_cast<std::size_t>(y + 1) * static_cast<std::size_t>(stride_) + static_cast<std::size_t>(x + 1)];
+    }
+    /// @brief 获取合并后的瓦片类型（越界时为 EMPTY）
+    engine::component::TileType getTileType(int x, int y) const {
+        return static_cast<engine::component::TileType>(getCell(x, y) & TYPE_MASK);
+    }
+    /// @brief 从单元格数据中取出 TileTrigger 掩码
+    static std::uint8_t getTriggers(std::uint16_t cell) {
+        return static_cast<std::uint8_t>(cell >> TRIGGER_SHIFT);
+    }
+
+    bool hasLayers() const { return has_layers_; }                  ///< @brief 是否合并了至少一个瓦片层
+    glm::vec2 getTileSize() const { return glm::vec2(tile_size_); } ///< @brief 获取瓦片尺寸（像素）
+    glm::ivec2 getMapSize() const { return map_size_; }             ///< @brief 获取网格尺寸（瓦片数）
+
+private:
+    /// @brief 瓦片类型的碰撞优先级（多层重叠时保留优先级最高的类型）
+    static int collisionPriority(engine::component::TileType type);
+};
+
+} // namespace engine::physics
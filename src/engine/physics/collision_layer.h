@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace engine::physics {
+
+/**
+ * @brief 碰撞类别（位掩码）。
+ *
+ * 每个 ColliderComponent 拥有一个类别 (category，通常只设置一位) 和一个掩码 (mask，可与之交互的类别集合)。
+ * 两个碰撞器只有在 (a.category & b.mask) && (b.category & a.mask) 时才会进行碰撞检测。
+ */
+namespace CollisionLayer {
+    constexpr std::uint32_t NONE    = 0;
+    constexpr std::uint32_t DEFAULT = 1u << 0;  ///< @brief 未分类的物体（与所有类别交互）
+    constexpr std::uint32_t SOLID   = 1u << 1;  ///< @brief 固体障碍物（箱子、平台等）
+    constexpr std::uint32_t PLAYER  = 1u << 2;  ///< @brief 玩家
+    constexpr std::uint32_t ENEMY   = 1u << 3;  ///< @brief 敌人
+    constexpr std::uint32_t ITEM    = 1u << 4;  ///< @brief 道具
+    constexpr std::uint32_t HAZARD  = 1u << 5;  ///< @brief 危险物（尖刺等）
+    constexpr std::uint32_t TRIGGER = 1u << 6;  ///< @brief 触发区域（关卡出口等）
+    constexpr std::uint32_t ALL     = 0xFFFFFFFFu;
+} // namespace CollisionLayer
+
+/**
+ * @brief 根据标签字符串获取对应的碰撞类别。未知标签返回 DEFAULT。
+ */
+constexpr std::uint32_t layerFromTag(std::string_view tag) {
+    if (tag == "solid") return CollisionLayer::SOLID;
+    if (tag == "player") return CollisionLayer::PLAYER;
+    if (tag == "enemy") return CollisionLayer::ENEMY;
+    if (tag == "item") return CollisionLayer::ITEM;
+    if (tag == "hazard") return CollisionLayer::HAZARD;
+    if (tag == "next_level") return CollisionLayer::TRIGGER;
+    return CollisionLayer::DEFAULT;
+}
+
+/**
+ * @brief 获取碰撞类别的默认掩码（即该类别需要与哪些类别进行碰撞检测）。
+ * @note 敌人之间、道具之间、固体之间以及静态的危险物/触发器与非玩家对象之间的碰撞不会被检测。
+ */
+constexpr std::uint32_t defaultMaskFor(std::uint32_t category) {
+    using namespace CollisionLayer;
+    switch (category) {
+        case SOLID:
+            return ALL & ~SOLID;
+        case ENEMY:
+        case ITEM:
+            return DEFAULT | SOLID | PLAYER;
+        case HAZARD:
+        case TRIGGER:
+            return DEFAULT | PLAYER;
+        default:    // DEFAULT、PLAYER 及自定义类别
+            return ALL;
+    }
+}
+
+} // namespace engine::physics
@@ -1,25 +1,55 @@
 #include "physics_engine.h"
 #include "collision.h"
+#include "collision_layer.h"
 #include "../component/physics_component.h"
 #include "../component/transform_component.h"
 #include "../component/collider_component.h"
 #include "../component/tilelayer_component.h"
 #include "../object/game_object.h"
-#include <set>
+#include "../core/thread_pool.h"
+#include <algorithm>
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
+#include <cmath>
+#include <bit>
+#include <atomic>
+#include <chrono>
 
 namespace engine::physics {
 
+namespace {
+using StatsClock = std::chrono::steady_clock;
+constexpr int MAX_CATCH_UP_STEPS = 16;     ///< @brief 每个物理步骤中单个物体最多额外模拟的次数 (超出的时间丢弃)
+/// @brief 计算从 start 到现在经过的毫秒数
+double elapsedMs(StatsClock::time_point start) {
+    return std::chrono::duration<double, std::milli>(StatsClock::now() - start).count();
+}
+} // namespace
+
 void PhysicsEngine::registerComponent(engine::component::PhysicsComponent* component) {
-    components_.push_back(component);
+    if (!component) return;
+    query_grid_dirty_ = true;
+    // 注册时缓存组件指针，之后的物理步骤不再需要通过 getComponent 查找
+    auto* owner = component->getOwner();
+    auto* cc = owner ? owner->getComponent<engine::component::ColliderComponent>() : nullptr;
+    bodies_.add(component, component->getTransform(), cc, owner);
     spdlog::trace("物理组件注册完成。");
 }
 
 void PhysicsEngine::unregisterComponent(engine::component::PhysicsComponent* component) {
-    // 使用 remove-erase 方法安全地移除指针
-    auto it = std::remove(components_.begin(), components_.end(), component);
-    components_.erase(it, components_.end());
+    auto index = bodies_.indexOf(component);
+    // SOLID物体被移除后，停在它上面或紧贴它的休眠物体可能失去支撑，需要唤醒
+    if (index < bodies_.size() && (bodies_.category[index] & CollisionLayer::SOLID)) {
+        constexpr float margin = 1.0f;
+        auto area = getBodyAABB(index);
+        wakeBodiesInArea({area.position - glm::vec2(margin), area.size + glm::vec2(margin * 2.0f)});
+    }
+    bodies_.removeAt(index);   // 找不到时 removeAt 不做任何处理 (O(1)，最后一个物体移到该位置)
+    query_grid_dirty_ = true;
+    // 对象即将销毁，清除它的接触记录，避免之后产生指向已销毁对象的事件
+    if (component) {
+        removeContactsOf(component->getOwner());
+    }
     spdlog::trace("物理组件注销完成。");
 }
 
@@ -27,298 +57,1100 @@ void PhysicsEngine::registerCollisionLayer(engine::component::TileLayerComponent
 {
     layer->setPhysicsEngine(this); // 设置物理引擎指针
     collision_tile_layers_.push_back(layer);
+    rebuildCollisionGrid();
     spdlog::trace("碰撞瓦片图层注册完成。");
 }
 
 void PhysicsEngine::unregisterCollisionLayer(engine::component::TileLayerComponent* layer) {
     auto it = std::remove(collision_tile_layers_.begin(), collision_tile_layers_.end(), layer);
     collision_tile_layers_.erase(it, collision_tile_layers_.end());
+    rebuildCollisionGrid();
     spdlog::trace("碰撞瓦片图层注销完成。");
 }
 
+void PhysicsEngine::rebuildCollisionGrid()
+{
+    collision_grid_.rebuild(collision_tile_layers_);
+    // 瓦片数据已改变，休眠物体的支撑可能已不存在
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        wakeBody(i);
+    }
+}
+
 void PhysicsEngine::update(float delta_time) {
+    // 统计数据只记录最近一帧
+    stats_ = {};
+    auto update_start = StatsClock::now();
+    auto finish_stats = [this, update_start]() {
+        stats_.substeps = last_substep_count_;
+        stats_.bodies = bodies_.size();
+        stats_.sleeping_bodies = sleeping_body_count_;
+        stats_.frozen_bodies = frozen_body_count_;
+        stats_.total_ms = elapsedMs(update_start);
+    };
+    // 确定性模式：与帧时间无关，每帧恰好执行一个固定步长
+    if (deterministic_) {
+        beginFrame();
+        step(fixed_time_step_);
+        endFrame();
+        last_substep_count_ = 1;
+        updateStateHash();
+        finish_stats();
+        return;
+    }
+
+    // 可变步长模式：每帧执行一次物理步骤
+    if (!fixed_time_step_enabled_) {
+        beginFrame();
+        step(delta_time);
+        endFrame();
+        last_substep_count_ = 1;
+        finish_stats();
+        return;
+    }
+
+    // 固定步长模式：累积帧时间，按固定步长执行若干子步。
+    // 组件上的力每帧都换算为冲量 (力 × 帧时间)，不论本帧执行几个子步，效果都只与实际经过的时间有关
+    accumulateImpulses(delta_time);
+    accumulator_ += delta_time;
+    int substeps = 0;
+    if (accumulator_ >= fixed_time_step_) {
+        beginFrame();
+        while (accumulator_ >= fixed_time_step_ && substeps < max_substeps_) {
+            step(fixed_time_step_);
+            accumulator_ -= fixed_time_step_;
+            ++substeps;
+        }
+        // 达到子步上限仍有剩余时间时直接丢弃 (低性能机器上表现为游戏变慢，而不是越积越多)
+        if (accumulator_ >= fixed_time_step_) {
+            accumulator_ = std::fmod(accumulator_, fixed_time_step_);
+        }
+        endFrame();
+    } else {
+        // 本帧没有执行子步：清空事件列表，避免游戏逻辑重复处理上一帧的事件，接触缓存保持不变
+        clearFrameEvents();
+        updateQueryIndex();     // 物体可能在上一帧注册/注销
+    }
+    last_substep_count_ = substeps;
+
+    // 渲染插值：按剩余累积时间在上一子步与当前子步的位置之间插值
+    if (interpolation_enabled_) {
+        applyInterpolation(accumulator_ / fixed_time_step_);
+    }
+    finish_stats();
+}
+
+void PhysicsEngine::setFixedTimeStep(float fixed_time_step) {
+    if (fixed_time_step <= 0.0f) {
+        spdlog::warn("物理固定步长必须为正数，忽略设置值: {}", fixed_time_step);
+        return;
+    }
+    fixed_time_step_ = fixed_time_step;
+}
+
+void PhysicsEngine::setDeterministic(bool deterministic) {
+    deterministic_ = deterministic;
+    accumulator_ = 0.0f;
+    state_hash_ = 0;
+    frame_count_ = 0;
+    spdlog::info("物理引擎确定性模式: {}", deterministic_ ? "开启" : "关闭");
+}
+
+void PhysicsEngine::updateStateHash()
+{
+    // FNV-1a：逐字节混入，浮点数按位模式参与运算，因此任何微小差异都会改变哈希
+    constexpr std::uint64_t fnv_offset = 14695981039346656037ull;
+    constexpr std::uint64_t fnv_prime = 1099511628211ull;
+    auto hash = frame_count_ == 0 ? fnv_offset : state_hash_;
+    auto mix = [&hash](std::uint32_t value) {
+        for (int i = 0; i < 4; ++i) {
+            hash ^= (value >> (i * 8)) & 0xFFu;
+            hash *= fnv_prime;
+        }
+    };
+    auto mix_vec2 = [&mix](const glm::vec2& v) {
+        mix(std::bit_cast<std::uint32_t>(v.x));
+        mix(std::bit_cast<std::uint32_t>(v.y));
+    };
+
+    mix(static_cast<std::uint32_t>(bodies_.size()));
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        mix_vec2(bodies_.position[i]);
+        mix_vec2(bodies_.velocity[i]);
+        mix(static_cast<std::uint32_t>(bodies_.flags[i]) | (static_cast<std::uint32_t>(bodies_.contact_flags[i]) << 8) |
+            (static_cast<std::uint32_t>(bodies_.tile_triggers[i]) << 16) | (static_cast<std::uint32_t>(bodies_.sleeping[i]) << 24));
+    }
+    mix(static_cast<std::uint32_t>(collision_begin_pairs_.size() + collision_stay_pairs_.size()));
+
+    state_hash_ = hash;
+    ++frame_count_;
+    spdlog::trace("物理帧 {} 状态哈希: {:016x}", frame_count_, state_hash_);
+}
+
+void PhysicsEngine::setMaxSubsteps(int max_substeps) {
+    if (max_substeps < 1) {
+        spdlog::warn("物理最大子步数至少为 1，忽略设置值: {}", max_substeps);
+        return;
+    }
+    max_substeps_ = max_substeps;
+}
+
+void PhysicsEngine::beginFrame()
+{
     // 每帧开始时先清空碰撞对列表和瓦片触发事件列表
     collision_pairs_.clear();
     tile_trigger_events_.clear();
 
-    // 遍历所有注册的物理组件
-    for (auto* pc : components_) {
-        if (!pc || !pc->isEnabled()) { // 检查组件是否有效和启用
+    // 从组件收集物体状态到连续数组中
+    gatherBodies();
+}
+
+void PhysicsEngine::step(float delta_time)
+{
+    // 积分和瓦片碰撞只读写各物体自身的数据（以及只读的瓦片层），因此可以按物体分块并行执行
+    bool parallel = thread_pool_ && parallel_enabled_ && bodies_.size() >= parallel_min_bodies_;
+    auto for_each_body = [this, parallel](engine::utils::FunctionRef<void(std::size_t, std::size_t)> func) {
+        if (parallel) {
+            thread_pool_->parallelFor(bodies_.size(), parallel_batch_size_, func);
+        } else {
+            func(0, bodies_.size());
+        }
+    };
+
+    // 1. 积分速度
+    auto stage_start = StatsClock::now();
+    std::atomic<std::uint32_t> integrated = 0;
+    for_each_body([this, delta_time, &integrated](std::size_t begin, std::size_t end) {
+        std::uint32_t count = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            count += integrateBody(i, delta_time) ? 1 : 0;
+        }
+        integrated.fetch_add(count, std::memory_order_relaxed);
+    });
+    stats_.bodies_integrated += integrated.load(std::memory_order_relaxed);
+    stats_.integrate_ms += elapsedMs(stage_start);
+
+    // 2. 瓦片碰撞（速度和位置的更新在其中完成）与世界边界
+    stage_start = StatsClock::now();
+    std::atomic<std::uint32_t> probes = 0;
+    for_each_body([this, delta_time, &probes](std::size_t begin, std::size_t end) {
+        std::uint32_t count = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!(bodies_.flags[i] & BodyFlag::ENABLED) || bodies_.sleeping[i]) continue;
+            count += resolveTileCollisions(i, delta_time);
+            applyWorldBounds(i);
+            if (bodies_.catch_up_time[i] >= delta_time) {
+                count += catchUpBody(i, delta_time);
+            }
+        }
+        probes.fetch_add(count, std::memory_order_relaxed);
+    });
+    stats_.tile_probes += probes.load(std::memory_order_relaxed);
+    stats_.tile_resolve_ms += elapsedMs(stage_start);
+
+    // 3. 处理对象间碰撞 (串行：碰撞对的处理会同时修改两个物体)
+    stage_start = StatsClock::now();
+    checkObjectCollisions();
+    stats_.object_pairs_ms += elapsedMs(stage_start);
+
+    // 4. 检测瓦片触发事件 (检测前已经处理完位移)
+    stage_start = StatsClock::now();
+    checkTileTriggers();
+    stats_.triggers_ms += elapsedMs(stage_start);
+
+    // 更新休眠状态
+    updateSleepStates(delta_time);
+}
+
+bool PhysicsEngine::integrateBody(std::size_t index, float delta_time)
+{
+    if (!(bodies_.flags[index] & BodyFlag::ENABLED) || bodies_.sleeping[index]) { // 检查组件是否启用，休眠物体无需模拟
+        return false;
+    }
+
+    bodies_.previous_position[index] = bodies_.position[index];   // 记录子步开始时的位置，用于渲染插值
+    bodies_.contact_flags[index] = 0;  // 重置碰撞标志
+
+    // 累积的冲量在第一个子步一次性施加：Δv = J / m
+    auto& impulse = bodies_.impulse[index];
+    if (impulse.x != 0.0f || impulse.y != 0.0f) {
+        bodies_.velocity[index] += impulse / bodies_.mass[index];
+        impulse = {0.0f, 0.0f};
+    }
+
+    // 计算加速度：a = F / m，受重力影响时再加上重力加速度 g
+    // (可变步长与确定性模式下每帧只有一个步骤，力在其中作用一次；固定步长模式下力已换算为冲量，这里为 0)
+    auto acceleration = bodies_.force[index] / bodies_.mass[index];
+    if (bodies_.flags[index] & BodyFlag::USE_GRAVITY) {
+        acceleration += gravity_;
+    }
+    /* 还可以添加其它力影响，比如风力、摩擦力等，目前不考虑 */
+
+    // 更新速度： v += a * dt
+    bodies_.velocity[index] += acceleration * delta_time;
+    return true;
+}
+
+std::uint32_t PhysicsEngine::catchUpBody(std::size_t index, float delta_time)
+{
+    // 按正常步长逐步模拟 (积分 + 瓦片碰撞)，而不是一次走完整段时间，避免大位移穿过瓦片
+    std::uint32_t probes = 0;
+    auto& remaining = bodies_.catch_up_time[index];
+    auto start_position = bodies_.previous_position[index];    // 本步正常积分前的位置
+    int steps = 0;
+    while (remaining >= delta_time && steps < MAX_CATCH_UP_STEPS) {
+        if (!integrateBody(index, delta_time)) break;
+        probes += resolveTileCollisions(index, delta_time);
+        applyWorldBounds(index);
+        remaining -= delta_time;
+        ++steps;
+    }
+    if (remaining >= delta_time) {
+        remaining = std::fmod(remaining, delta_time);
+    }
+    // 对象碰撞和休眠判断只在步骤中进行一次，扫过的区域从补上的第一步开始计算
+    bodies_.previous_position[index] = start_position;
+    return probes;
+}
+
+void PhysicsEngine::endFrame()
+{
+    // 根据接触缓存生成开始/持续/结束事件 (多个子步产生的重复碰撞对在此合并)
+    updateContacts();
+
+    // 瓦片触发器掩码变化时生成进入/离开事件
+    updateTileTriggerEvents();
+    stats_.trigger_events = static_cast<std::uint32_t>(tile_trigger_events_.size());
+    stats_.collision_events = static_cast<std::uint32_t>(collision_begin_pairs_.size() + collision_stay_pairs_.size() +
+                                                         collision_end_pairs_.size());
+
+    // 将计算结果统一写回组件
+    scatterBodies();
+
+    // 物体位置已变化，在主线程上重建空间查询的索引
+    query_grid_dirty_ = true;
+    updateQueryIndex();
+
+    // 统计休眠物体数量
+    sleeping_body_count_ = static_cast<std::size_t>(std::count(bodies_.sleeping.begin(), bodies_.sleeping.end(), std::uint8_t{1}));
+    frozen_body_count_ = static_cast<std::size_t>(std::count(bodies_.frozen.begin(), bodies_.frozen.end(), std::uint8_t{1}));
+}
+
+void PhysicsEngine::updateSleepStates(float delta_time)
+{
+    if (!sleep_enabled_) return;
+    auto velocity_threshold_sq = sleep_velocity_threshold_ * sleep_velocity_threshold_;
+    auto move_threshold = sleep_velocity_threshold_ * delta_time;
+    auto move_threshold_sq = move_threshold * move_threshold;
+
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        if (!(bodies_.flags[i] & BodyFlag::ENABLED) || bodies_.sleeping[i]) continue;
+
+        // 速度和本步位移都足够小才视为静止
+        const auto& velocity = bodies_.velocity[i];
+        auto moved = bodies_.position[i] - bodies_.previous_position[i];
+        bool is_still = velocity.x * velocity.x + velocity.y * velocity.y < velocity_threshold_sq &&
+                        moved.x * moved.x + moved.y * moved.y < move_threshold_sq;
+        // 受重力影响的物体还必须有支撑 (否则可能只是处在跳跃的最高点)
+        if (is_still && (bodies_.flags[i] & BodyFlag::USE_GRAVITY) && !(bodies_.contact_flags[i] & ContactFlag::BELOW)) {
+            is_still = false;
+        }
+        if (!is_still) {
+            bodies_.sleep_timer[i] = 0.0f;
             continue;
         }
 
-        pc->resetCollisionFlags();  // 重置碰撞标志
+        bodies_.sleep_timer[i] += delta_time;
+        if (bodies_.sleep_timer[i] >= time_to_sleep_) {
+            bodies_.sleeping[i] = 1;
+            bodies_.velocity[i] = {0.0f, 0.0f};
+            bodies_.previous_position[i] = bodies_.position[i];
+            // 休眠前把最终状态写回组件，之后的帧会跳过写回
+            auto* pc = bodies_.components[i];
+            bodies_.transforms[i]->setPosition(bodies_.position[i]);
+            pc->velocity_ = bodies_.velocity[i];
+        }
+    }
+}
+
+void PhysicsEngine::wakeBody(std::size_t index)
+{
+    if (bodies_.frozen[index]) return;      // 冻结的物体只能由组件解冻
+    bodies_.sleeping[index] = 0;
+    bodies_.sleep_timer[index] = 0.0f;
+}
 
-        // 应用重力 (如果组件受重力影响)：F = g * m
-        if (pc->isUseGravity()) {
-            pc->addForce(gravity_ * pc->getMass());
+void PhysicsEngine::wakeBodiesInArea(const engine::utils::Rect& area)
+{
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        if (!bodies_.sleeping[i]) continue;
+        auto aabb = getBodyAABB(i);
+        if (aabb.position.x <= area.position.x + area.size.x && area.position.x <= aabb.position.x + aabb.size.x &&
+            aabb.position.y <= area.position.y + area.size.y && area.position.y <= aabb.position.y + aabb.size.y) {
+            wakeBody(i);
         }
-        /* 还可以添加其它力影响，比如风力、摩擦力等，目前不考虑 */
-        
-        // 更新速度： v += a * dt，其中 a = F / m
-        pc->velocity_ += (pc->getForce() / pc->getMass()) * delta_time;
-        pc->clearForce(); // 清除当前帧的力
+    }
+}
 
-        // 处理瓦片层碰撞（速度和位置的更新移入此函数）
-        resolveTileCollisions(pc, delta_time);
+void PhysicsEngine::wakeBodyOf(const engine::object::GameObject* obj)
+{
+    // 通过物理组件记录的序号直接定位，不搜索物体表
+    auto* pc = obj ? obj->getComponent<engine::component::PhysicsComponent>() : nullptr;
+    auto index = bodies_.indexOf(pc);
+    if (index < bodies_.size()) {
+        wakeBody(index);
+    }
+}
 
-        // 应用世界边界
-        applyWorldBounds(pc);
+void PhysicsEngine::wakeUp(engine::component::PhysicsComponent* component)
+{
+    auto index = bodies_.indexOf(component);
+    if (index < bodies_.size()) {
+        wakeBody(index);
     }
-    // 处理对象间碰撞
-    checkObjectCollisions();
+}
 
-    // 检测瓦片触发事件 (检测前已经处理完位移)
-    checkTileTriggers();
+bool PhysicsEngine::isSleeping(const engine::component::PhysicsComponent* component) const
+{
+    auto index = bodies_.indexOf(component);
+    return index < bodies_.size() && bodies_.sleeping[index];
+}
+
+void PhysicsEngine::clearFrameEvents()
+{
+    collision_pairs_.clear();
+    tile_trigger_events_.clear();
+    collision_begin_pairs_.clear();
+    collision_stay_pairs_.clear();
+    collision_end_pairs_.clear();
+}
+
+void PhysicsEngine::applyInterpolation(float alpha)
+{
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        if (!(bodies_.flags[i] & BodyFlag::ENABLED)) continue;
+        auto* tc = bodies_.transforms[i];
+        const auto& position = bodies_.position[i];
+        // 如果游戏逻辑在物理步骤之后直接修改了位置 (例如瞬移)，则不做插值
+        if (tc->getPosition().x != position.x || tc->getPosition().y != position.y) {
+            tc->setRenderOffset({0.0f, 0.0f});
+            continue;
+        }
+        // 渲染位置 = mix(上一子步位置, 当前位置, alpha)，这里只记录相对当前位置的偏移
+        tc->setRenderOffset((bodies_.previous_position[i] - position) * (1.0f - alpha));
+    }
+}
+
+void PhysicsEngine::gatherBodies()
+{
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        auto* pc = bodies_.components[i];
+        auto* tc = bodies_.transforms[i];
+        // Transform/碰撞组件可能在物理组件之后才添加，此时补充查找一次
+        if (!tc && bodies_.owners[i]) {
+            tc = bodies_.transforms[i] = bodies_.owners[i]->getComponent<engine::component::TransformComponent>();
+        }
+        std::uint8_t flags = 0;
+        if (pc->isEnabled() && tc) flags |= BodyFlag::ENABLED;     // 没有 Transform 的物体无法参与模拟
+        if (pc->isUseGravity()) flags |= BodyFlag::USE_GRAVITY;
+
+        auto* cc = bodies_.colliders[i];
+        if (!cc && bodies_.owners[i]) {
+            cc = bodies_.colliders[i] = bodies_.owners[i]->getComponent<engine::component::ColliderComponent>();
+        }
+        if (cc && cc->getCollider() && tc) {
+            flags |= BodyFlag::HAS_COLLIDER;
+            if (cc->isActive()) flags |= BodyFlag::COLLIDER_ACTIVE;
+            if (cc->isTrigger()) flags |= BodyFlag::TRIGGER;
+            bodies_.aabb_offset[i] = cc->getOffset();
+            bodies_.aabb_size[i] = cc->getCollider()->getAABBSize() * tc->getScale();
+            bodies_.shape[i] = cc->getCollider()->getType();
+            bodies_.category[i] = cc->getCategory();
+            bodies_.mask[i] = cc->getMask();
+        }
+        auto previous_flags = bodies_.flags[i];
+        bodies_.flags[i] = flags;
+
+        // 冻结的物体：视为休眠 (保留速度等状态)，只同步位置，使宽阶段和空间查询仍能看到它
+        if (pc->isFrozen()) {
+            bodies_.frozen[i] = 1;
+            bodies_.sleeping[i] = 1;
+            bodies_.impulse[i] = {0.0f, 0.0f};     // 冻结期间施加的力不保留
+            bodies_.sleep_timer[i] = 0.0f;
+            if (tc) bodies_.position[i] = bodies_.previous_position[i] = tc->getPosition();
+            continue;
+        }
+        // 解冻：从组件中冻结时的状态继续模拟
+        if (bodies_.frozen[i]) {
+            bodies_.frozen[i] = 0;
+            wakeBody(i);
+        }
+        // 降频更新的物体在更新帧请求补上冻结期间的时间
+        if (auto catch_up_time = pc->takeCatchUpTime(); catch_up_time > 0.0f) {
+            bodies_.catch_up_time[i] += catch_up_time;
+            wakeBody(i);
+        }
+        if (!(flags & BodyFlag::ENABLED)) {
+            wakeBody(i);    // 禁用的物体不保留休眠状态
+            continue;
+        }
+
+        // 休眠物体：如果外部修改了速度、位置、施加了力或改变了状态标志，则唤醒，否则状态保持不变
+        if (bodies_.sleeping[i]) {
+            constexpr float epsilon = 1e-4f;
+            auto velocity_change = pc->velocity_ - bodies_.velocity[i];
+            auto position_change = tc->getPosition() - bodies_.position[i];
+            bool changed = previous_flags != flags ||
+                           std::abs(velocity_change.x) > epsilon || std::abs(velocity_change.y) > epsilon ||
+                           std::abs(position_change.x) > epsilon || std::abs(position_change.y) > epsilon ||
+                           pc->getForce().x != 0.0f || pc->getForce().y != 0.0f ||
+                           bodies_.impulse[i].x != 0.0f || bodies_.impulse[i].y != 0.0f;
+            if (!changed) continue;
+            wakeBody(i);
+        }
+
+        bodies_.position[i] = tc->getPosition();
+        bodies_.velocity[i] = pc->velocity_;
+        bodies_.force[i] = pc->getForce();
+        bodies_.mass[i] = pc->getMass();
+    }
+}
+
+void PhysicsEngine::accumulateImpulses(float delta_time)
+{
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        auto* pc = bodies_.components[i];
+        const auto& force = pc->getForce();
+        if (force.x == 0.0f && force.y == 0.0f) continue;
+        bodies_.impulse[i] += force * delta_time;
+        pc->clearForce();       // 外力只在一帧内有效 (不执行子步的帧也要清除，否则会累积到下一次子步)
+    }
+}
+
+void PhysicsEngine::scatterBodies()
+{
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        // 休眠物体的状态没有变化 (入睡时已写回)，碰撞标志也保持入睡前的值
+        if (!(bodies_.flags[i] & BodyFlag::ENABLED) || bodies_.sleeping[i]) continue;
+        auto* pc = bodies_.components[i];
+        bodies_.transforms[i]->setPosition(bodies_.position[i]);
+        pc->velocity_ = bodies_.velocity[i];
+        pc->clearForce();       // 外力只在一帧内有效
+
+        auto contact = bodies_.contact_flags[i];
+        pc->resetCollisionFlags();
+        pc->setCollidedBelow(contact & ContactFlag::BELOW);
+        pc->setCollidedAbove(contact & ContactFlag::ABOVE);
+        pc->setCollidedLeft(contact & ContactFlag::LEFT);
+        pc->setCollidedRight(contact & ContactFlag::RIGHT);
+        pc->setOnTopLadder(contact & ContactFlag::ON_TOP_LADDER);
+        pc->setTileTriggers(bodies_.tile_triggers[i]);
+    }
+}
+
+engine::utils::Rect PhysicsEngine::getSweptAABB(std::size_t index) const
+{
+    const auto& start = bodies_.previous_position[index];
+    const auto& end = bodies_.position[index];
+    return {glm::min(start, end) + bodies_.aabb_offset[index], bodies_.aabb_size[index] + glm::abs(end - start)};
 }
 
 void PhysicsEngine::checkObjectCollisions()
 {
-    // 两层循环遍历所有包含物理组件的 GameObject
-    for (size_t i = 0; i < components_.size(); ++i) {
-        auto* pc_a = components_[i];
-        if (!pc_a || !pc_a->isEnabled()) continue;
-        auto* obj_a = pc_a->getOwner();
-        if (!obj_a) continue;
-        auto* cc_a = obj_a->getComponent<engine::component::ColliderComponent>();
-        if (!cc_a || !cc_a->isActive()) continue;
-
-        for (size_t j = i + 1; j < components_.size(); ++j) {
-            auto* pc_b = components_[j];
-            if (!pc_b || !pc_b->isEnabled()) continue;
-            auto* obj_b = pc_b->getOwner();
-            if (!obj_b) continue;
-            auto* cc_b = obj_b->getComponent<engine::component::ColliderComponent>();
-            if (!cc_b || !cc_b->isActive()) continue;
-            /* --- 通过保护性测试后，正式执行逻辑 --- */
-
-            if (collision::checkCollision(*cc_a, *cc_b)) {
-                // 如果是可移动物体与SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对
-                if (obj_a->getTag() != "solid" && obj_b->getTag() == "solid") {
-                    resolveSolidObjectCollisions(obj_a, obj_b);
-                }
-                else if (obj_a->getTag() == "solid" && obj_b->getTag() != "solid") {
-                    resolveSolidObjectCollisions(obj_b, obj_a);
-                }
-                else {
-                    // 记录碰撞对
-                    collision_pairs_.emplace_back(obj_a, obj_b);
-                }
-            }
+    // 收集所有可参与碰撞检测的物体，并插入宽阶段网格
+    broadphase_bodies_.clear();
+    spatial_grid_.clear();
+    constexpr std::uint8_t required = BodyFlag::ENABLED | BodyFlag::HAS_COLLIDER | BodyFlag::COLLIDER_ACTIVE;
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        if ((bodies_.flags[i] & required) != required || !bodies_.owners[i]) continue;
+        // 不与任何类别交互的物体无需进入宽阶段
+        if (bodies_.category[i] == CollisionLayer::NONE || bodies_.mask[i] == CollisionLayer::NONE) continue;
+
+        // 插入本步扫过的区域，使高速物体也能与途中经过的物体组成候选对
+        spatial_grid_.insert(static_cast<std::uint32_t>(broadphase_bodies_.size()), getSweptAABB(i));
+        broadphase_bodies_.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    // 宽阶段：只有共享网格单元的物体才需要精确检测。
+    // 候选对按 (i, j > i) 的字典序给出，因此检测顺序和碰撞对的记录顺序与两两遍历时一致。
+    spatial_grid_.findPairs(candidate_pairs_);
+    stats_.broadphase_pairs += static_cast<std::uint32_t>(candidate_pairs_.size());
+
+    // 候选对按 first 分块：块内所有 second 打包后与 first 做一次批量检测 (SIMD)，
+    // 再按原顺序逐对处理，保证结果、碰撞对顺序与逐对检测时相同。
+    std::size_t block_start = 0;
+    while (block_start < candidate_pairs_.size()) {
+        auto pair_i = candidate_pairs_[block_start].first;
+        auto block_end = block_start + 1;
+        while (block_end < candidate_pairs_.size() && candidate_pairs_[block_end].first == pair_i) ++block_end;
+
+        auto a = broadphase_bodies_[pair_i];
+        narrow_batch_.clear();
+        for (auto k = block_start; k < block_end; ++k) {
+            auto b = broadphase_bodies_[candidate_pairs_[k].second];
+            narrow_batch_.add(bodies_.shape[b], getBodyAABB(b));
+        }
+        collision::checkCollisionBatch(bodies_.shape[a], getBodyAABB(a), narrow_batch_, narrow_hits_);
+        // 块内的 SOLID 处理可能移动 a，之后批量结果失效，剩余的对改为逐对检测
+        bool a_moved = false;
+
+        for (auto k = block_start; k < block_end; ++k) {
+            checkObjectPair(a, broadphase_bodies_[candidate_pairs_[k].second], k - block_start, a_moved);
+        }
+        block_start = block_end;
+    }
+}
+
+void PhysicsEngine::checkObjectPair(std::uint32_t a, std::uint32_t b, std::size_t batch_index, bool& a_moved)
+{
+    /* --- 通过保护性测试后，正式执行逻辑 --- */
+
+    // 类别/掩码不匹配的物体对永远不会交互，直接跳过
+    if (!(bodies_.category[a] & bodies_.mask[b]) || !(bodies_.category[b] & bodies_.mask[a])) return;
+
+    // 双方都在休眠：相对位置没有变化，无需检测，直接沿用上一帧的接触
+    if (bodies_.sleeping[a] && bodies_.sleeping[b]) {
+        auto key = makeContactKey(bodies_.owners[a], bodies_.owners[b]);
+        if (std::binary_search(contact_keys_.begin(), contact_keys_.end(), key)) {
+            collision_pairs_.emplace_back(bodies_.owners[a], bodies_.owners[b]);
+        }
+        return;
+    }
+
+    // 如果是可移动物体与SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对
+    bool solid_a = (bodies_.category[a] & CollisionLayer::SOLID) != 0;
+    bool solid_b = (bodies_.category[b] & CollisionLayer::SOLID) != 0;
+    if (solid_a != solid_b) {
+        auto move_index = solid_a ? b : a;
+        auto solid_index = solid_a ? a : b;
+        // 终点不重叠时也可能在途中穿过了SOLID物体，由扫掠检测负责
+        ++stats_.narrowphase_tests;
+        if (resolveSolidObjectCollisions(move_index, solid_index)) {
+            ++stats_.narrowphase_hits;
+            ++stats_.solid_resolutions;
+            if (move_index == a) a_moved = true;
+            if (bodies_.sleeping[move_index]) wakeBody(move_index);   // 被活动的SOLID物体推动，唤醒
+        }
+        return;
+    }
+    ++stats_.narrowphase_tests;
+    bool hit = a_moved ? collision::checkCollision(bodies_.shape[a], getBodyAABB(a), bodies_.shape[b], getBodyAABB(b))
+                       : collision::testHit(narrow_hits_, batch_index);
+    if (hit) {
+        ++stats_.narrowphase_hits;
+        // 与活动物体接触的休眠物体需要唤醒 (游戏逻辑可能会改变它的状态)
+        if (bodies_.sleeping[a]) wakeBody(a);
+        if (bodies_.sleeping[b]) wakeBody(b);
+        // 记录碰撞对
+        collision_pairs_.emplace_back(bodies_.owners[a], bodies_.owners[b]);
+    }
+}
+
+void PhysicsEngine::updateQueryIndex()
+{
+    if (!query_grid_dirty_) return;
+    query_grid_.clear();
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        if (!isQueryable(i, CollisionLayer::ALL)) continue;
+        query_grid_.insert(static_cast<std::uint32_t>(i), getBodyAABB(i));
+    }
+    query_grid_.build();
+    query_grid_dirty_ = false;
+}
+
+bool PhysicsEngine::isFirstQueryCell(std::size_t index, const engine::utils::Rect& area, int cell_x, int cell_y) const
+{
+    // 物体与查询区域共同覆盖的第一个单元格 = 两者起始单元格中较大的一个 (网格由同样的AABB建立)
+    auto aabb = getBodyAABB(index);
+    return cell_x == std::max(query_grid_.toCell(aabb.position.x), query_grid_.toCell(area.position.x)) &&
+           cell_y == std::max(query_grid_.toCell(aabb.position.y), query_grid_.toCell(area.position.y));
+}
+
+bool PhysicsEngine::isQueryable(std::size_t index, std::uint32_t mask) const
+{
+    constexpr std::uint8_t required = BodyFlag::ENABLED | BodyFlag::HAS_COLLIDER | BodyFlag::COLLIDER_ACTIVE;
+    return (bodies_.flags[index] & required) == required && bodies_.owners[index] && (bodies_.category[index] & mask);
+}
+
+std::optional<RaycastHit> PhysicsEngine::raycast(const glm::vec2& origin, const glm::vec2& direction, float max_distance,
+                                                 std::uint32_t mask, bool include_tiles) const
+{
+    auto length = glm::length(direction);
+    if (length <= 0.0f || max_distance <= 0.0f || !std::isfinite(max_distance)) return std::nullopt;
+    auto dir = direction / length;
+
+    // 先检测瓦片，命中时缩短射线，之后只需在更短的范围内寻找物体
+    std::optional<RaycastHit> best;
+    if (include_tiles) {
+        best = raycastTiles(origin, origin + dir * max_distance);
+    }
+    auto best_distance = best ? best->distance : max_distance;
+
+    // 射线相当于尺寸为零的AABB沿射线方向扫掠。结果与检测次数无关，因此跨越多个单元格的物体重复检测也无妨
+    auto test_body = [&](std::uint32_t index) {
+        if (!isQueryable(index, mask)) return;
+        auto hit = collision::sweepAABB({origin, {0.0f, 0.0f}}, dir * best_distance, getBodyAABB(index));
+        if (!hit) return;
+        best_distance *= hit->time;
+        best = RaycastHit{bodies_.owners[index], {-1, -1}, origin + dir * best_distance, hit->normal, best_distance};
+    };
+    // 索引过期 (本帧有物体注册/注销) 时逐个检测
+    if (query_grid_dirty_) {
+        for (std::size_t i = 0; i < bodies_.size(); ++i) test_body(static_cast<std::uint32_t>(i));
+        return best;
+    }
+
+    // 只遍历射线在物体索引范围内的一段 (超出范围的单元格都是空的)
+    float t_start = 0.0f;
+    float t_end = best_distance;
+    if (query_grid_.empty() || !collision::clipRay(origin, dir, query_grid_.getBounds(), t_start, t_end)) return best;
+    auto cell_size = query_grid_.getCellSize();
+    auto start = origin + dir * t_start;
+    collision::traverseGrid(start, dir, t_end - t_start, {cell_size, cell_size}, [&](const collision::GridCellVisit& visit) {
+        query_grid_.queryCell(visit.cell.x, visit.cell.y, test_body);
+        // 已命中的点在当前单元格之内时，后面的单元格不可能有更近的命中
+        return !(best && best_distance <= t_start + visit.t_exit);
+    });
+    return best;
+}
+
+std::optional<RaycastHit> PhysicsEngine::raycastTiles(const glm::vec2& start, const glm::vec2& end) const
+{
+    if (!collision_grid_.hasLayers()) return std::nullopt;
+    auto delta = end - start;
+    auto length = glm::length(delta);
+    if (length <= 0.0f || !std::isfinite(length)) return std::nullopt;
+    auto dir = delta / length;
+
+    // 地图之外都是空白瓦片，只需遍历线段在地图范围内的一段
+    auto tile_size = collision_grid_.getTileSize();
+    float t_start = 0.0f;
+    float t_end = length;
+    engine::utils::Rect map_bounds = {{0.0f, 0.0f}, glm::vec2(collision_grid_.getMapSize()) * tile_size};
+    if (!collision::clipRay(start, dir, map_bounds, t_start, t_end)) return std::nullopt;
+
+    std::optional<RaycastHit> result;
+    auto clipped_start = start + dir * t_start;
+    collision::traverseGrid(clipped_start, dir, t_end - t_start, tile_size, [&](const collision::GridCellVisit& visit) {
+        if (collision_grid_.getTileType(visit.cell.x, visit.cell.y) != engine::component::TileType::SOLID) return true;
+        auto distance = t_start + visit.t_enter;
+        result = RaycastHit{nullptr, visit.cell, start + dir * distance, visit.normal, distance};
+        return false;
+    });
+    return result;
+}
+
+std::size_t PhysicsEngine::overlapBox(const engine::utils::Rect& area, std::uint32_t mask,
+                                      engine::utils::FunctionRef<void(engine::object::GameObject*)> callback) const
+{
+    std::size_t count = 0;
+    auto test_body = [&](std::size_t index) {
+        if (!isQueryable(index, mask)) return;
+        if (!collision::checkCollision(ColliderType::AABB, area, bodies_.shape[index], getBodyAABB(index))) return;
+        callback(bodies_.owners[index]);
+        ++count;
+    };
+    // 索引过期 (本帧有物体注册/注销) 时逐个检测
+    if (query_grid_dirty_) {
+        for (std::size_t i = 0; i < bodies_.size(); ++i) test_body(i);
+        return count;
+    }
+    query_grid_.query(area, [&](std::uint32_t index, int cell_x, int cell_y) {
+        if (!isFirstQueryCell(index, area, cell_x, cell_y)) return;    // 跨越多个单元格的物体只报告一次
+        test_body(index);
+    });
+    return count;
+}
+
+std::size_t PhysicsEngine::queryNearest(const glm::vec2& point, float max_distance, std::size_t k, std::uint32_t mask,
+                                        engine::utils::FunctionRef<void(engine::object::GameObject*, float)> callback) const
+{
+    if (k == 0 || max_distance < 0.0f || !std::isfinite(max_distance)) return 0;
+
+    // 候选缓冲区按线程复用。取出后再使用，回调中嵌套的查询会得到另一个 (空的) 缓冲区
+    thread_local std::vector<std::pair<float, std::uint32_t>> cached_buffer;
+    std::vector<std::pair<float, std::uint32_t>> nearest;
+    nearest.swap(cached_buffer);
+    nearest.clear();
+
+    // 收集查询半径内的候选，只保留距离最近的 k 个 (有序插入，k 通常很小)
+    auto test_body = [&](std::uint32_t index) {
+        if (!isQueryable(index, mask)) return;
+        auto aabb = getBodyAABB(index);
+        auto distance = glm::length(glm::clamp(point, aabb.position, aabb.position + aabb.size) - point);
+        if (distance > max_distance) return;
+        if (nearest.size() == k && distance >= nearest.back().first) return;
+
+        auto candidate = std::make_pair(distance, index);
+        auto position = std::upper_bound(nearest.begin(), nearest.end(), candidate) - nearest.begin();
+        if (nearest.size() == k) nearest.pop_back();
+        nearest.insert(nearest.begin() + position, candidate);
+    };
+    engine::utils::Rect area = {point - glm::vec2(max_distance), glm::vec2(max_distance * 2.0f)};
+    if (query_grid_dirty_) {
+        for (std::size_t i = 0; i < bodies_.size(); ++i) test_body(static_cast<std::uint32_t>(i));
+    } else {
+        query_grid_.query(area, [&](std::uint32_t index, int cell_x, int cell_y) {
+            if (isFirstQueryCell(index, area, cell_x, cell_y)) test_body(index);
+        });
+    }
+
+    for (const auto& [distance, index] : nearest) {
+        callback(bodies_.owners[index], distance);
+    }
+    auto count = nearest.size();
+    nearest.swap(cached_buffer);    // 归还缓冲区 (保留容量)
+    return count;
+}
+
+void PhysicsEngine::updateContacts()
+{
+    collision_begin_pairs_.clear();
+    collision_stay_pairs_.clear();
+    collision_end_pairs_.clear();
+
+    // 本帧接触的键值 (排序后用于查找已分离的接触)，同时合并多个子步产生的重复碰撞对 (保留首次出现的顺序)
+    pair_order_.clear();
+    for (std::size_t i = 0; i < collision_pairs_.size(); ++i) {
+        pair_order_.emplace_back(makeContactKey(collision_pairs_[i].first, collision_pairs_[i].second), i);
+    }
+    std::sort(pair_order_.begin(), pair_order_.end());
+    current_keys_.clear();
+    pair_keep_.assign(collision_pairs_.size(), 0);
+    for (std::size_t i = 0; i < pair_order_.size(); ++i) {
+        if (i == 0 || pair_order_[i].first != pair_order_[i - 1].first) {
+            current_keys_.push_back(pair_order_[i].first);
+            pair_keep_[pair_order_[i].second] = 1;
+        }
+    }
+    if (current_keys_.size() != collision_pairs_.size()) {
+        std::size_t write = 0;
+        for (std::size_t read = 0; read < collision_pairs_.size(); ++read) {
+            if (pair_keep_[read]) collision_pairs_[write++] = collision_pairs_[read];
         }
+        collision_pairs_.resize(write);
     }
+
+    // 上一帧已存在的为持续接触，否则为新接触 (保持发现顺序)
+    for (const auto& pair : collision_pairs_) {
+        auto key = makeContactKey(pair.first, pair.second);
+        if (std::binary_search(contact_keys_.begin(), contact_keys_.end(), key)) {
+            collision_stay_pairs_.push_back(pair);
+        } else {
+            collision_begin_pairs_.push_back(pair);
+        }
+    }
+    // 上一帧存在而本帧不存在的为结束接触
+    for (const auto& pair : contacts_) {
+        auto key = makeContactKey(pair.first, pair.second);
+        if (!std::binary_search(current_keys_.begin(), current_keys_.end(), key)) {
+            collision_end_pairs_.push_back(pair);
+        }
+    }
+
+    // 本帧接触成为下一帧的缓存 (交换容器以复用内存)
+    contacts_.assign(collision_pairs_.begin(), collision_pairs_.end());
+    contact_keys_.swap(current_keys_);
 }
 
-void PhysicsEngine::resolveTileCollisions(engine::component::PhysicsComponent* pc, float delta_time) {
-    // 检查组件是否有效
-    auto* obj = pc->getOwner();
+void PhysicsEngine::removeContactsOf(const engine::object::GameObject* obj)
+{
     if (!obj) return;
-    auto* tc = obj->getComponent<engine::component::TransformComponent>();
-    auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-    if (!tc || !cc || cc->isTrigger()) return;
-    auto world_aabb = cc->getWorldAABB();   // 使用最小包围盒进行碰撞检测（简化）
+    // 与被移除对象接触的物体可能失去支撑，唤醒它们
+    for (const auto& [obj_a, obj_b] : contacts_) {
+        if (obj_a == obj) wakeBodyOf(obj_b);
+        else if (obj_b == obj) wakeBodyOf(obj_a);
+    }
+    auto involves = [obj](const auto& pair) { return pair.first == obj || pair.second == obj; };
+    std::erase_if(contacts_, involves);
+    std::erase_if(collision_pairs_, involves);
+    std::erase_if(collision_begin_pairs_, involves);
+    std::erase_if(collision_stay_pairs_, involves);
+    std::erase_if(collision_end_pairs_, involves);
+    std::erase_if(tile_trigger_events_, [obj](const auto& event) { return event.object == obj; });
+
+    auto address = reinterpret_cast<std::uintptr_t>(obj);
+    std::erase_if(contact_keys_, [address](const ContactKey& key) {
+        return key.first == address || key.second == address;
+    });
+}
+
+PhysicsEngine::ContactKey PhysicsEngine::makeContactKey(const engine::object::GameObject* a, const engine::object::GameObject* b)
+{
+    auto address_a = reinterpret_cast<std::uintptr_t>(a);
+    auto address_b = reinterpret_cast<std::uintptr_t>(b);
+    return address_a < address_b ? ContactKey{address_a, address_b} : ContactKey{address_b, address_a};
+}
+
+std::uint32_t PhysicsEngine::resolveTileCollisions(std::size_t index, float delta_time) {
+    // 检查物体是否有效
+    auto flags = bodies_.flags[index];
+    if (!(flags & BodyFlag::HAS_COLLIDER) || (flags & BodyFlag::TRIGGER)) return 0;
+    auto& velocity = bodies_.velocity[index];
+    auto& position = bodies_.position[index];
+    auto& contact = bodies_.contact_flags[index];
+    auto world_aabb = getBodyAABB(index);   // 使用最小包围盒进行碰撞检测（简化）
     auto obj_pos = world_aabb.position;
     auto obj_size = world_aabb.size;
-    if (world_aabb.size.x <= 0.0f || world_aabb.size.y <= 0.0f) return;
+    if (world_aabb.size.x <= 0.0f || world_aabb.size.y <= 0.0f) return 0;
     // -- 检查结束, 正式开始处理 --
     
     constexpr float tolerance = 1.0f;       // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
-    auto ds = pc->velocity_ * delta_time;  // 计算物体在delta_time内的位移
+    auto ds = velocity * delta_time;  // 计算物体在delta_time内的位移
     auto new_obj_pos = obj_pos + ds;        // 计算物体在delta_time后的新位置
 
-    if (!cc->isActive()) {  // 如果碰撞器未激活，直接让物体正常移动，然后返回。
-        tc->translate(ds);
-        pc->velocity_ = glm::clamp(pc->velocity_, -max_speed_, max_speed_);
-        return;
+    if (!(flags & BodyFlag::COLLIDER_ACTIVE)) {  // 如果碰撞器未激活，直接让物体正常移动，然后返回。
+        position += ds;
+        velocity = glm::clamp(velocity, -max_speed_, max_speed_);
+        return 0;
     }
 
     // 遍历所有注册的碰撞瓦片层
-    for (auto* layer : collision_tile_layers_) {
-        if (!layer) continue;
-        auto tile_size = layer->getTileSize();
+    // 所有碰撞瓦片层已合并为一个碰撞网格，只需查询一次
+    std::uint32_t probes = 0;   // 查询瓦片的次数 (性能统计)
+    if (collision_grid_.hasLayers()) {
+        const auto& grid = collision_grid_;
+        auto tile_size = grid.getTileSize();
+        using engine::component::TileType;
+        auto tile_at = [&grid, &probes](int x, int y) {
+            ++probes;
+            return grid.getTileType(x, y);
+        };
+        // 指定行中 [x_begin, x_end] 范围内是否存在满足条件的瓦片
+        auto row_has = [&tile_at](int x_begin, int x_end, int y, auto predicate) {
+            for (int x = x_begin; x <= x_end; ++x) {
+                if (predicate(tile_at(x, y))) return true;
+            }
+            return false;
+        };
+        // 指定列中 [y_begin, y_end] 范围内是否存在 SOLID 瓦片
+        auto column_has_solid = [&tile_at](int x, int y_begin, int y_end) {
+            for (int y = y_begin; y <= y_end; ++y) {
+                if (tile_at(x, y) == TileType::SOLID) return true;
+            }
+            return false;
+        };
+        auto is_solid = [](TileType type) { return type == TileType::SOLID; };
+        auto is_ground = [](TileType type) { return type == TileType::SOLID || type == TileType::UNISOLID; };
+
+        // 扫掠检测 (DDA)：沿移动方向依次检查前缘经过的每一行/列瓦片，第一个阻挡处即为碰撞时刻。
+        // 因此一步之内移动多个瓦片的高速物体也不会穿过墙壁或地面。
         // 轴分离碰撞检测：先检查X方向是否有碰撞 (y方向使用初始值obj_pos.y)
+        auto tile_y = static_cast<int>(floor(obj_pos.y / tile_size.y));
+        auto tile_y_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));
         if (ds.x > 0.0f) {
-            // 检查右侧碰撞，需要分别测试右上和右下角
-            auto right_top_x = new_obj_pos.x + obj_size.x;
-            auto tile_x = static_cast<int>(floor(right_top_x / tile_size.x));   // 获取x方向瓦片坐标
-            // y方向坐标有两个，右上和右下
-            auto tile_y = static_cast<int>(floor(obj_pos.y / tile_size.y));
-            auto tile_type_top = layer->getTileTypeAt({tile_x, tile_y});        // 右上角瓦片类型
-            auto tile_y_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));
-            auto tile_type_bottom = layer->getTileTypeAt({tile_x, tile_y_bottom});     // 右下角瓦片类型
-
-            if (tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID) {
-                // 撞墙了！速度归零，x方向移动到贴着墙的位置
-                new_obj_pos.x = tile_x * layer->getTileSize().x - obj_size.x;
-                pc->velocity_.x = 0.0f;
-                pc->setCollidedRight(true);
-            } else {
-                // 检测右下角斜坡瓦片
-                auto width_right = new_obj_pos.x + obj_size.x - tile_x * tile_size.x;
+            // 检查右侧碰撞，测试右边缘从起点到终点经过的每一列
+            auto first_x = static_cast<int>(floor((obj_pos.x + obj_size.x) / tile_size.x));
+            auto last_x = static_cast<int>(floor((new_obj_pos.x + obj_size.x) / tile_size.x));
+            bool blocked = false;
+            for (int tile_x = first_x; tile_x <= last_x; ++tile_x) {
+                if (column_has_solid(tile_x, tile_y, tile_y_bottom)) {
+                    // 撞墙了！速度归零，x方向移动到贴着墙的位置
+                    new_obj_pos.x = tile_x * tile_size.x - obj_size.x;
+                    velocity.x = 0.0f;
+                    contact |= ContactFlag::RIGHT;
+                    blocked = true;
+                    break;
+                }
+            }
+            if (!blocked) {
+                // 检测右下角斜坡瓦片 (只需检查终点所在列)
+                auto tile_type_bottom = tile_at(last_x, tile_y_bottom);
+                auto width_right = new_obj_pos.x + obj_size.x - last_x * tile_size.x;
                 auto height_right = getTileHeightAtWidth(width_right, tile_type_bottom, tile_size);
                 if (height_right > 0.0f) {
                     // 如果有碰撞（角点的世界y坐标 > 斜坡地面的世界y坐标）, 就让物体贴着斜坡表面
-                    if (new_obj_pos.y > (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_right) {
-                        new_obj_pos.y = (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_right;
-                        pc->setCollidedBelow(true);
+                    if (new_obj_pos.y > (tile_y_bottom + 1) * tile_size.y - obj_size.y - height_right) {
+                        new_obj_pos.y = (tile_y_bottom + 1) * tile_size.y - obj_size.y - height_right;
+                        contact |= ContactFlag::BELOW;
                     }
                 }
             }
         }
         else if (ds.x < 0.0f) {
-            // 检查左侧碰撞，需要分别测试左上和左下角
-            auto left_top_x = new_obj_pos.x;
-            auto tile_x = static_cast<int>(floor(left_top_x / tile_size.x));    // 获取x方向瓦片坐标
-            // y方向坐标有两个，左上和左下
-            auto tile_y = static_cast<int>(floor(obj_pos.y / tile_size.y));
-            auto tile_type_top = layer->getTileTypeAt({tile_x, tile_y});        // 左上角瓦片类型
-            auto tile_y_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));
-            auto tile_type_bottom = layer->getTileTypeAt({tile_x, tile_y_bottom});     // 左下角瓦片类型
-
-            if (tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID) {
-                // 撞墙了！速度归零，x方向移动到贴着墙的位置
-                new_obj_pos.x = (tile_x + 1) * layer->getTileSize().x;
-                pc->velocity_.x = 0.0f;
-                pc->setCollidedLeft(true);
-            } else {
-                // 检测左下角斜坡瓦片
-                auto width_left = new_obj_pos.x - tile_x * tile_size.x;
+            // 检查左侧碰撞，测试左边缘从起点到终点经过的每一列
+            auto first_x = static_cast<int>(floor(obj_pos.x / tile_size.x));
+            auto last_x = static_cast<int>(floor(new_obj_pos.x / tile_size.x));
+            bool blocked = false;
+            for (int tile_x = first_x; tile_x >= last_x; --tile_x) {
+                if (column_has_solid(tile_x, tile_y, tile_y_bottom)) {
+                    // 撞墙了！速度归零，x方向移动到贴着墙的位置
+                    new_obj_pos.x = (tile_x + 1) * tile_size.x;
+                    velocity.x = 0.0f;
+                    contact |= ContactFlag::LEFT;
+                    blocked = true;
+                    break;
+                }
+            }
+            if (!blocked) {
+                // 检测左下角斜坡瓦片 (只需检查终点所在列)
+                auto tile_type_bottom = tile_at(last_x, tile_y_bottom);
+                auto width_left = new_obj_pos.x - last_x * tile_size.x;
                 auto height_left = getTileHeightAtWidth(width_left, tile_type_bottom, tile_size);
                 if (height_left > 0.0f) {
-                    if (new_obj_pos.y > (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_left) {
-                        new_obj_pos.y = (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_left;
-                        pc->setCollidedBelow(true);
+                    if (new_obj_pos.y > (tile_y_bottom + 1) * tile_size.y - obj_size.y - height_left) {
+                        new_obj_pos.y = (tile_y_bottom + 1) * tile_size.y - obj_size.y - height_left;
+                        contact |= ContactFlag::BELOW;
                     }
                 }
             }
         }
         // 轴分离碰撞检测：再检查Y方向是否有碰撞 (x方向使用初始值obj_pos.x)
+        auto tile_x = static_cast<int>(floor(obj_pos.x / tile_size.x));
+        auto tile_x_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));
         if (ds.y > 0.0f) {
-            // 检查底部碰撞，需要分别测试左下和右下角
-            auto bottom_left_y = new_obj_pos.y + obj_size.y;
-            auto tile_y = static_cast<int>(floor(bottom_left_y / tile_size.y));
-
-            auto tile_x = static_cast<int>(floor(obj_pos.x / tile_size.x));
-            auto tile_type_left = layer->getTileTypeAt({tile_x, tile_y});           // 左下角瓦片类型   
-            auto tile_x_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));
-            auto tile_type_right = layer->getTileTypeAt({tile_x_right, tile_y});     // 右下角瓦片类型
-
-            if (tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID ||
-                tile_type_left == engine::component::TileType::UNISOLID || tile_type_right == engine::component::TileType::UNISOLID) {
-                // 到达地面！速度归零，y方向移动到贴着地面的位置
-                new_obj_pos.y = tile_y * layer->getTileSize().y - obj_size.y;
-                pc->velocity_.y = 0.0f;
-                pc->setCollidedBelow(true);
-            // 如果两个角点都位于梯子上，则判断是不是处在梯子顶层
-            } else if (tile_type_left == engine::component::TileType::LADDER && tile_type_right == engine::component::TileType::LADDER) {
-                auto tile_type_up_l = layer->getTileTypeAt({tile_x, tile_y - 1});       // 检测左角点上方瓦片类型
-                auto tile_type_up_r = layer->getTileTypeAt({tile_x_right, tile_y - 1}); // 检测右角点上方瓦片类型
-                // 如果上方不是梯子，证明处在梯子顶层
-                if (tile_type_up_r != engine::component::TileType::LADDER && tile_type_up_l != engine::component::TileType::LADDER) {
-                    // 通过是否使用重力来区分是否处于攀爬状态。
-                    if (pc->isUseGravity()) {   // 非攀爬状态
-                        pc->setOnTopLadder(true);       // 设置在梯子顶层标志
-                        pc->setCollidedBelow(true);     // 设置下方碰撞标志
+            // 检查底部碰撞，测试下边缘从起点到终点经过的每一行
+            auto first_y = static_cast<int>(floor((obj_pos.y + obj_size.y) / tile_size.y));
+            auto last_y = static_cast<int>(floor((new_obj_pos.y + obj_size.y) / tile_size.y));
+            for (int row = first_y; row <= last_y; ++row) {
+                auto tile_type_left = tile_at(tile_x, row);           // 左下角瓦片类型
+                auto tile_type_right = tile_at(tile_x_right, row);    // 右下角瓦片类型
+
+                if (row_has(tile_x, tile_x_right, row, is_ground)) {
+                    // 到达地面！速度归零，y方向移动到贴着地面的位置
+                    new_obj_pos.y = row * tile_size.y - obj_size.y;
+                    velocity.y = 0.0f;
+                    contact |= ContactFlag::BELOW;
+                    break;
+                // 如果两个角点都位于梯子上，则判断是不是处在梯子顶层
+                } else if (tile_type_left == TileType::LADDER && tile_type_right == TileType::LADDER) {
+                    auto tile_type_up_l = tile_at(tile_x, row - 1);       // 检测左角点上方瓦片类型
+                    auto tile_type_up_r = tile_at(tile_x_right, row - 1); // 检测右角点上方瓦片类型
+                    // 如果上方不是梯子，证明处在梯子顶层
+                    // 通过是否使用重力来区分是否处于攀爬状态。攀爬状态不做任何处理，继续检查下一行
+                    if (tile_type_up_r != TileType::LADDER && tile_type_up_l != TileType::LADDER &&
+                        (flags & BodyFlag::USE_GRAVITY)) {
+                        contact |= ContactFlag::ON_TOP_LADDER;       // 设置在梯子顶层标志
+                        contact |= ContactFlag::BELOW;     // 设置下方碰撞标志
                         // 让物体贴着梯子顶层位置(与SOLID情况相同)
-                        new_obj_pos.y = tile_y * layer->getTileSize().y - obj_size.y;
-                        pc->velocity_.y = 0.0f;
-                    } else {}    // 攀爬状态，不做任何处理
-                }
-            } else {
-                // 检测斜坡瓦片（下方两个角点都要检测）
-                auto width_left = obj_pos.x - tile_x * tile_size.x;
-                auto width_right = obj_pos.x + obj_size.x - tile_x_right * tile_size.x;
-                auto height_left = getTileHeightAtWidth(width_left, tile_type_left, tile_size);
-                auto height_right = getTileHeightAtWidth(width_right, tile_type_right, tile_size);
-                auto height = glm::max(height_left, height_right);  // 找到两个角点的最高点进行检测
-                if (height > 0.0f) {    // 说明至少有一个角点处于斜坡瓦片
-                    if (new_obj_pos.y > (tile_y + 1) * layer->getTileSize().y - obj_size.y - height) {
-                        new_obj_pos.y = (tile_y + 1) * layer->getTileSize().y - obj_size.y - height;
-                        pc->velocity_.y = 0.0f;     // 只有向下运动时才需要让 y 速度归零
-                        pc->setCollidedBelow(true);
+                        new_obj_pos.y = row * tile_size.y - obj_size.y;
+                        velocity.y = 0.0f;
+                        break;
+                    }
+                } else {
+                    // 检测斜坡瓦片（下方两个角点都要检测）
+                    auto width_left = obj_pos.x - tile_x * tile_size.x;
+                    auto width_right = obj_pos.x + obj_size.x - tile_x_right * tile_size.x;
+                    auto height_left = getTileHeightAtWidth(width_left, tile_type_left, tile_size);
+                    auto height_right = getTileHeightAtWidth(width_right, tile_type_right, tile_size);
+                    auto height = glm::max(height_left, height_right);  // 找到两个角点的最高点进行检测
+                    if (height > 0.0f) {    // 说明至少有一个角点处于斜坡瓦片
+                        if (new_obj_pos.y > (row + 1) * tile_size.y - obj_size.y - height) {
+                            new_obj_pos.y = (row + 1) * tile_size.y - obj_size.y - height;
+                            velocity.y = 0.0f;     // 只有向下运动时才需要让 y 速度归零
+                            contact |= ContactFlag::BELOW;
+                            break;
+                        }
                     }
                 }
             }
         }
         else if (ds.y < 0.0f) {
-            // 检查顶部碰撞，需要分别测试左上和右上角
-            auto top_left_y = new_obj_pos.y;
-            auto tile_y = static_cast<int>(floor(top_left_y / tile_size.y));
-
-            auto tile_x = static_cast<int>(floor(obj_pos.x / tile_size.x));
-            auto tile_type_left = layer->getTileTypeAt({tile_x, tile_y});        // 左上角瓦片类型
-            auto tile_x_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));
-            auto tile_type_right = layer->getTileTypeAt({tile_x_right, tile_y});     // 右上角瓦片类型
-
-            if (tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID) {
-                // 撞到天花板！速度归零，y方向移动到贴着天花板的位置
-                new_obj_pos.y = (tile_y + 1) * layer->getTileSize().y;
-                pc->velocity_.y = 0.0f;
-                pc->setCollidedAbove(true);
+            // 检查顶部碰撞，测试上边缘从起点到终点经过的每一行
+            auto first_y = static_cast<int>(floor(obj_pos.y / tile_size.y));
+            auto last_y = static_cast<int>(floor(new_obj_pos.y / tile_size.y));
+            for (int row = first_y; row >= last_y; --row) {
+                if (row_has(tile_x, tile_x_right, row, is_solid)) {
+                    // 撞到天花板！速度归零，y方向移动到贴着天花板的位置
+                    new_obj_pos.y = (row + 1) * tile_size.y;
+                    velocity.y = 0.0f;
+                    contact |= ContactFlag::ABOVE;
+                    break;
+                }
             }
         }
     }
     // 更新物体位置，并限制最大速度
-    tc->translate(new_obj_pos - obj_pos);   // 使用translate方法，避免直接设置位置，因为碰撞盒可能有偏移量
-    pc->velocity_ = glm::clamp(pc->velocity_, -max_speed_, max_speed_);
+    position += new_obj_pos - obj_pos;      // 使用位移量，避免直接设置位置，因为碰撞盒可能有偏移量
+    velocity = glm::clamp(velocity, -max_speed_, max_speed_);
+    return probes;
 }
 
-void PhysicsEngine::resolveSolidObjectCollisions(engine::object::GameObject* move_obj, engine::object::GameObject* solid_obj)
+bool PhysicsEngine::resolveSolidObjectCollisions(std::size_t move_index, std::size_t solid_index)
 {
-    // 进入此函数前，已经检查了各个组件的有效性，因此直接进行计算
-    auto* move_tc = move_obj->getComponent<engine::component::TransformComponent>();
-    auto* move_pc = move_obj->getComponent<engine::component::PhysicsComponent>();
-    auto* move_cc = move_obj->getComponent<engine::component::ColliderComponent>();
-    auto* solid_cc = solid_obj->getComponent<engine::component::ColliderComponent>();
+    // 进入此函数前，已经检查了各个物体的有效性，因此直接进行计算
+    auto& move_position = bodies_.position[move_index];
+    auto& move_velocity = bodies_.velocity[move_index];
+    auto& move_contact = bodies_.contact_flags[move_index];
+
+    auto move_aabb = getBodyAABB(move_index);
+    auto solid_aabb = getBodyAABB(solid_index);
+
+    // --- 先进行扫掠检测：以SOLID物体为参照系，求移动物体在本步位移中第一次接触它的时刻 ---
+    auto motion = (move_position - bodies_.previous_position[move_index]) -
+                  (bodies_.position[solid_index] - bodies_.previous_position[solid_index]);
+    engine::utils::Rect start_aabb = {move_aabb.position - motion, move_aabb.size};
+    if (auto hit = collision::sweepAABB(start_aabb, motion, solid_aabb)) {
+        // 沿碰撞轴退回到接触位置，另一轴保持终点位置 (贴着表面滑动)
+        if (hit->normal.x != 0.0f) {
+            move_position.x -= motion.x * (1.0f - hit->time);
+            if (hit->normal.x < 0.0f && move_velocity.x > 0.0f) {
+                move_velocity.x = 0.0f;
+                move_contact |= ContactFlag::RIGHT;
+            } else if (hit->normal.x > 0.0f && move_velocity.x < 0.0f) {
+                move_velocity.x = 0.0f;
+                move_contact |= ContactFlag::LEFT;
+            }
+        } else {
+            move_position.y -= motion.y * (1.0f - hit->time);
+            if (hit->normal.y < 0.0f && move_velocity.y > 0.0f) {
+                move_velocity.y = 0.0f;
+                move_contact |= ContactFlag::BELOW;
+            } else if (hit->normal.y > 0.0f && move_velocity.y < 0.0f) {
+                move_velocity.y = 0.0f;
+                move_contact |= ContactFlag::ABOVE;
+            }
+        }
+        return true;
+    }
 
-    // 这里只能获取期望位置，无法获取当前帧初始位置，因此无法进行轴分离碰撞检测
-    /* 未来可以进行重构，让这里可以获取初始位置。但是我们展示另外一种处理方法 */
-    auto move_aabb = move_cc->getWorldAABB();
-    auto solid_aabb = solid_cc->getWorldAABB();
+    // 起始时已经重叠 (例如被生成在SOLID物体内部)：终点重叠时退回到最小平移向量的处理方式
+    if (!collision::checkCollision(bodies_.shape[move_index], move_aabb, bodies_.shape[solid_index], solid_aabb)) return false;
 
     // --- 使用最小平移向量解决碰撞问题 ---
     auto move_center = move_aabb.position + move_aabb.size / 2.0f;
     auto solid_center = solid_aabb.position + solid_aabb.size / 2.0f;
     // 计算两个包围盒的重叠部分
     auto overlap = glm::vec2(move_aabb.size / 2.0f + solid_aabb.size / 2.0f) - glm::abs(move_center - solid_center);
-    if (overlap.x < 0.1f && overlap.y < 0.1f) return;  // 如果重叠部分太小，则认为没有碰撞
+    if (overlap.x < 0.1f && overlap.y < 0.1f) return false;  // 如果重叠部分太小，则认为没有碰撞
 
     if (overlap.x < overlap.y) {    // 如果重叠部分在x方向上更小，则认为碰撞发生在x方向上（推出x方向平移向量最小）
         if (move_center.x < solid_center.x) {
             // 移动物体在左边，让它贴着右边SOLID物体（相当于向左移出重叠部分），y方向正常移动
-            move_tc->translate(glm::vec2(-overlap.x, 0.0f));
+            move_position += glm::vec2(-overlap.x, 0.0f);
             // 如果速度为正(向右移动)，则归零 （if判断不可少，否则可能出现错误吸附）
-            if (move_pc->velocity_.x > 0.0f) {
-                move_pc->velocity_.x = 0.0f;
-                move_pc->setCollidedRight(true);
+            if (move_velocity.x > 0.0f) {
+                move_velocity.x = 0.0f;
+                move_contact |= ContactFlag::RIGHT;
             }
         }
         else {
             // 移动物体在右边，让它贴着左边SOLID物体（相当于向右移出重叠部分），y方向正常移动
-            move_tc->translate(glm::vec2(overlap.x, 0.0f));
-            if (move_pc->velocity_.x < 0.0f) {
-                move_pc->velocity_.x = 0.0f;
-                move_pc->setCollidedLeft(true);
+            move_position += glm::vec2(overlap.x, 0.0f);
+            if (move_velocity.x < 0.0f) {
+                move_velocity.x = 0.0f;
+                move_contact |= ContactFlag::LEFT;
             }
         }
     } else {                        // 重叠部分在y方向上更小，则认为碰撞发生在y方向上（推出y方向平移向量最小）
         if (move_center.y < solid_center.y) {
             // 移动物体在上面，让它贴着下面SOLID物体（相当于向上移出重叠部分），x方向正常移动
-            move_tc->translate(glm::vec2(0.0f, -overlap.y));
-            if (move_pc->velocity_.y > 0.0f) {
-                move_pc->velocity_.y = 0.0f;
-                move_pc->setCollidedBelow(true);
+            move_position += glm::vec2(0.0f, -overlap.y);
+            if (move_velocity.y > 0.0f) {
+                move_velocity.y = 0.0f;
+                move_contact |= ContactFlag::BELOW;
             }
         }
         else {
             // 移动物体在下面，让它贴着上面SOLID物体（相当于向下移出重叠部分），x方向正常移动
-            move_tc->translate(glm::vec2(0.0f, overlap.y));
-            if (move_pc->velocity_.y < 0.0f) {
-                move_pc->velocity_.y = 0.0f;
-                move_pc->setCollidedAbove(true);
+            move_position += glm::vec2(0.0f, overlap.y);
+            if (move_velocity.y < 0.0f) {
+                move_velocity.y = 0.0f;
+                move_contact |= ContactFlag::ABOVE;
             }
         }
     }
+    return true;
 }
 
 float PhysicsEngine::getTileHeightAtWidth(float width, engine::component::TileType type, glm::vec2 tile_size)
@@ -344,86 +1176,94 @@ float PhysicsEngine::getTileHeightAtWidth(float width, engine::component::TileTy
 
 void PhysicsEngine::checkTileTriggers()
 {
-    for (auto* pc : components_) {
-        if (!pc || !pc->isEnabled()) continue;  // 检查组件是否有效和启用
-        auto* obj = pc->getOwner();
-        if (!obj) continue;
-        auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-        if (!cc || !cc->isActive() || cc->isTrigger()) continue;    // 如果游戏对象本就是触发器，则不需要检查瓦片触发事件
+    const auto& grid = collision_grid_;
+    auto tile_size = grid.getTileSize();
+
+    constexpr std::uint8_t required = BodyFlag::ENABLED | BodyFlag::HAS_COLLIDER | BodyFlag::COLLIDER_ACTIVE;
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        auto flags = bodies_.flags[i];
+        // 未启用、没有激活的碰撞器、本身就是触发器的物体，以及没有瓦片层时，不覆盖任何触发器瓦片
+        if ((flags & required) != required || (flags & BodyFlag::TRIGGER) || !bodies_.owners[i] || !grid.hasLayers()) {
+            bodies_.tile_triggers[i] = TileTrigger::NONE;
+            continue;
+        }
+        // 休眠物体的位置没有变化，直接沿用上一次的结果
+        if (bodies_.sleeping[i]) continue;
 
         // 获取物体的世界AABB
-        auto world_aabb = cc->getWorldAABB();
-
-        // 使用 set 来跟踪循环遍历中已经触发过的瓦片类型，防止重复添加（例如，玩家同时踩到两个尖刺，只需要受到一次伤害）
-        std::set<engine::component::TileType> triggers_set;
-
-        // 遍历所有注册的碰撞瓦片层分别进行检测
-        for (auto* layer : collision_tile_layers_) {
-            if (!layer) continue;
-            auto tile_size = layer->getTileSize();
-            constexpr float tolerance = 1.0f;   // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
-            // 获取瓦片坐标范围
-            auto start_x = static_cast<int>(floor(world_aabb.position.x / tile_size.x));
-            auto end_x = static_cast<int>(ceil((world_aabb.position.x + world_aabb.size.x - tolerance) / tile_size.x));
-            auto start_y = static_cast<int>(floor(world_aabb.position.y / tile_size.y));
-            auto end_y = static_cast<int>(ceil((world_aabb.position.y + world_aabb.size.y - tolerance) / tile_size.y));
-
-            // 遍历瓦片坐标范围进行检测
+        auto world_aabb = getBodyAABB(i);
+
+        constexpr float tolerance = 1.0f;   // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
+        // 获取瓦片坐标范围
+        auto start_x = static_cast<int>(floor(world_aabb.position.x / tile_size.x));
+        auto end_x = static_cast<int>(ceil((world_aabb.position.x + world_aabb.size.x - tolerance) / tile_size.x));
+        auto start_y = static_cast<int>(floor(world_aabb.position.y / tile_size.y));
+        auto end_y = static_cast<int>(ceil((world_aabb.position.y + world_aabb.size.y - tolerance) / tile_size.y));
+
+        // 合并覆盖范围内所有单元格的触发器标志（例如玩家同时踩到两个尖刺，只算一次）
+        std::uint16_t cells = 0;
+        for (int y = start_y; y < end_y; ++y) {
             for (int x = start_x; x < end_x; ++x) {
-                for (int y = start_y; y < end_y; ++y) {
-                    auto tile_type = layer->getTileTypeAt({x, y});
-                    // 未来可以添加更多触发器类型的瓦片，目前只有 HAZARD 类型
-                    if (tile_type == engine::component::TileType::HAZARD) {
-                        triggers_set.insert(tile_type);     // 记录触发事件，set 保证每个瓦片类型只记录一次
-                    }
-                    // 梯子类型不必记录到事件容器，物理引擎自己处理
-                    else if (tile_type == engine::component::TileType::LADDER) { 
-                        pc->setCollidedLadder(true);
-                    }
-                }
+                cells |= grid.getCell(x, y);
             }
-            // 遍历触发事件集合，添加到 tile_trigger_events_ 中
-            for (const auto& type : triggers_set) {
-                tile_trigger_events_.emplace_back(obj, type);
-                spdlog::trace("tile_trigger_events_中 添加了 GameObject {} 和瓦片触发类型: {}", 
-                    obj->getName(), static_cast<int>(type));
+        }
+        stats_.tile_probes += static_cast<std::uint32_t>(std::max(0, end_x - start_x) * std::max(0, end_y - start_y));
+        bodies_.tile_triggers[i] = CollisionGrid::getTriggers(cells);
+    }
+}
+
+void PhysicsEngine::updateTileTriggerEvents()
+{
+    // 与上一次产生事件时的掩码对比，只为发生变化的位产生进入/离开事件 (多个子步中的反复变化在此合并)
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        auto current = bodies_.tile_triggers[i];
+        auto previous = bodies_.reported_triggers[i];
+        if (current == previous) continue;
+        bodies_.reported_triggers[i] = current;
+        auto* obj = bodies_.owners[i];
+        if (!obj) continue;
+
+        for (auto trigger : {TileTrigger::HAZARD, TileTrigger::LADDER}) {
+            if ((current ^ previous) & trigger) {
+                bool entered = (current & trigger) != 0;
+                tile_trigger_events_.push_back({obj, trigger, entered});
+                spdlog::trace("GameObject {} {} 瓦片触发器: {}", obj->getName(), entered ? "进入" : "离开", trigger);
             }
         }
     }
 }
 
-void PhysicsEngine::applyWorldBounds(engine::component::PhysicsComponent *pc)
+void PhysicsEngine::applyWorldBounds(std::size_t index)
 {
-    if (!pc || !world_bounds_) return;
+    if (!world_bounds_ || !(bodies_.flags[index] & BodyFlag::HAS_COLLIDER)) return;
 
     // 只限定左、上、右边界，不限定下边界，以碰撞盒作为判断依据
-    auto* obj = pc->getOwner();
-    auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-    auto* tc = obj->getComponent<engine::component::TransformComponent>();
-    auto world_aabb = cc->getWorldAABB();
+    auto& velocity = bodies_.velocity[index];
+    auto& contact = bodies_.contact_flags[index];
+    auto world_aabb = getBodyAABB(index);
     auto obj_pos = world_aabb.position;
     auto obj_size = world_aabb.size;
 
     // 检查左边界
     if (obj_pos.x < world_bounds_->position.x) {
-        pc->velocity_.x = 0.0f;
+        velocity.x = 0.0f;
         obj_pos.x = world_bounds_->position.x;
-        pc->setCollidedLeft(true);
+        contact |= ContactFlag::LEFT;
     }
     // 检查上边界
     if (obj_pos.y < world_bounds_->position.y) {
-        pc->velocity_.y = 0.0f;
+        velocity.y = 0.0f;
         obj_pos.y = world_bounds_->position.y;
-        pc->setCollidedAbove(true);
+        contact |= ContactFlag::ABOVE;
     }
     // 检查右边界
     if (obj_pos.x + obj_size.x > world_bounds_->position.x + world_bounds_->size.x) {
-        pc->velocity_.x = 0.0f;
+        velocity.x = 0.0f;
         obj_pos.x = world_bounds_->position.x + world_bounds_->size.x - obj_size.x;
-        pc->setCollidedRight(true);
+        contact |= ContactFlag::RIGHT;
     }
-    // 更新物体位置(使用translate方法，新位置 - 旧位置)
-    tc->translate(obj_pos - world_aabb.position);
+    // 更新物体位置(新位置 - 旧位置)
+    bodies_.position[index] += obj_pos - world_aabb.position;
 }
 
 } // namespace engine::physics 
\ No newline at end of file
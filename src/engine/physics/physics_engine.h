@@ -1,12 +1,22 @@
 #pragma once
+#include "spatial_grid.h"
+#include "body_store.h"
+#include "collision_grid.h"
+#include "collision_layer.h"
+#include "tile_trigger.h"
+#include "physics_stats.h"
+#include "collision.h"
 #include "../utils/math.h"
+#include "../utils/function_ref.h"
 #include <vector>
+#include <cstdint>
 #include <utility>  // for std::pair
 #include <optional>
 #include <glm/vec2.hpp>
 
 namespace engine::component {
     class PhysicsComponent;
+    class ColliderComponent;
     class TileLayerComponent;
     enum class TileType;
 }
@@ -15,23 +25,94 @@ namespace engine::object {
     class GameObject;
 }
 
+namespace engine::core {
+    class ThreadPool;
+}
+
 namespace engine::physics {
 
+/// @brief 射线检测的结果
+struct RaycastHit {
+    engine::object::GameObject* object = nullptr;   ///< @brief 命中的游戏对象 (命中瓦片时为空)
+    glm::ivec2 tile = {-1, -1};                     ///< @brief 命中的瓦片坐标 (命中游戏对象时为 -1)
+    glm::vec2 point = {0.0f, 0.0f};                 ///< @brief 命中点 (世界坐标)
+    glm::vec2 normal = {0.0f, 0.0f};                ///< @brief 命中面的法线 (起点位于瓦片内部时为零向量)
+    float distance = 0.0f;                          ///< @brief 起点到命中点的距离
+};
+
+/// @brief 瓦片触发器事件：物体进入或离开某种触发器瓦片
+struct TileTriggerEvent {
+    engine::object::GameObject* object = nullptr;   ///< @brief 触发事件的游戏对象
+    std::uint8_t trigger = TileTrigger::NONE;       ///< @brief 触发器类型 (TileTrigger 中的一位)
+    bool entered = false;                           ///< @brief true 为进入，false 为离开
+};
+
 /**
  * @brief 负责管理和模拟物理行为及碰撞检测。
  */
 class PhysicsEngine {
 private:
-    std::vector<engine::component::PhysicsComponent*> components_; ///< @brief 注册的物理组件容器，非拥有指针
+    BodyStore bodies_;      ///< @brief 注册的物理物体 (SoA 存储，缓存非拥有的组件指针)
     std::vector<engine::component::TileLayerComponent*> collision_tile_layers_; ///< @brief 注册的碰撞瓦片图层容器
+    CollisionGrid collision_grid_;              ///< @brief 由所有碰撞瓦片层合并而成的碰撞网格 (注册/注销图层时重建)
     glm::vec2 gravity_ = {0.0f, 980.0f};        ///< @brief 默认重力值 (像素/秒^2, 相当于100像素对应现实1m)
     float max_speed_ = 500.0f;                  ///< @brief 最大速度 (像素/秒)
     std::optional<engine::utils::Rect> world_bounds_;     ///< @brief 世界边界，用于限制物体移动范围
 
+    // --- 固定时间步长 ---
+    bool fixed_time_step_enabled_ = false;      ///< @brief 是否使用固定时间步长 (否则每帧按帧时间执行一次)
+    float fixed_time_step_ = 1.0f / 60.0f;      ///< @brief 固定步长 (秒)
+    int max_substeps_ = 5;                      ///< @brief 每帧最多执行的子步数
+    bool interpolation_enabled_ = true;         ///< @brief 是否对渲染位置进行插值 (仅固定步长模式)
+    float accumulator_ = 0.0f;                  ///< @brief 尚未模拟的累积时间
+    int last_substep_count_ = 0;                ///< @brief 上一帧执行的子步数
+
+    // --- 确定性模式 ---
+    bool deterministic_ = false;                ///< @brief 是否为确定性模式 (每次 update 恰好执行一个固定步长，并计算状态哈希)
+    std::uint64_t state_hash_ = 0;              ///< @brief 滚动状态哈希 (每帧把所有物体状态混入上一帧的哈希)
+    std::uint64_t frame_count_ = 0;             ///< @brief 确定性模式下已模拟的帧数
+
+    PhysicsStats stats_;                        ///< @brief 最近一帧的统计数据
+
+    // --- 并行积分 ---
+    engine::core::ThreadPool* thread_pool_ = nullptr;   ///< @brief 工作线程池 (非拥有，为空时串行执行)
+    bool parallel_enabled_ = false;                     ///< @brief 是否并行执行积分和瓦片碰撞
+    std::size_t parallel_min_bodies_ = 256;             ///< @brief 物体数量达到此值才并行 (太少时同步开销大于收益)
+    std::size_t parallel_batch_size_ = 64;              ///< @brief 每个线程每次领取的最少物体数
+
+    // --- 休眠 ---
+    bool sleep_enabled_ = true;                 ///< @brief 是否允许物体休眠
+    float sleep_velocity_threshold_ = 2.0f;     ///< @brief 低于此速度 (像素/秒) 视为静止
+    float time_to_sleep_ = 0.5f;                ///< @brief 持续静止多久后进入休眠 (秒)
+    std::size_t sleeping_body_count_ = 0;       ///< @brief 上一帧结束时处于休眠的物体数量
+    std::size_t frozen_body_count_ = 0;         ///< @brief 上一帧结束时被冻结的物体数量
+
     /// @brief 存储本帧发生的 GameObject 碰撞对 （每次 update 开始时清空）
     std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>> collision_pairs_;
-    /// @brief 存储本帧发生的瓦片触发事件 (GameObject*, 触发的瓦片类型, 每次 update 开始时清空)
-    std::vector<std::pair<engine::object::GameObject*, engine::component::TileType>> tile_trigger_events_;
+
+    // --- 持久接触缓存：对比上一帧与本帧的碰撞对，生成 开始/持续/结束 三类事件 ---
+    using ContactKey = std::pair<std::uintptr_t, std::uintptr_t>;   ///< @brief 与顺序无关的接触键值 (较小地址, 较大地址)
+    std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>> contacts_; ///< @brief 上一帧的接触 (按发现顺序)
+    std::vector<ContactKey> contact_keys_;          ///< @brief 上一帧接触的键值 (已排序，用于二分查找)
+    std::vector<ContactKey> current_keys_;          ///< @brief 本帧接触的键值 (已排序，跨帧复用)
+    std::vector<std::pair<ContactKey, std::size_t>> pair_order_;    ///< @brief (键值, 碰撞对序号)，用于合并重复碰撞对
+    std::vector<std::uint8_t> pair_keep_;           ///< @brief 碰撞对是否保留 (首次出现)
+    std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>> collision_begin_pairs_; ///< @brief 本帧新产生的接触
+    std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>> collision_stay_pairs_;  ///< @brief 上一帧已存在、本帧仍持续的接触
+    std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>> collision_end_pairs_;   ///< @brief 上一帧存在、本帧已分离的接触
+    /// @brief 存储本帧发生的瓦片触发器进入/离开事件 (每次 update 开始时清空)
+    std::vector<TileTriggerEvent> tile_trigger_events_;
+
+    // --- 对象碰撞宽阶段 (broadphase) 所用数据，容器跨帧复用 ---
+    std::vector<std::uint32_t> broadphase_bodies_;  ///< @brief 参与对象碰撞检测的物体序号 (bodies_ 索引，保持物体表顺序)
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> candidate_pairs_;  ///< @brief 宽阶段筛选出的候选对 (broadphase_bodies_ 索引)
+    SpatialGrid spatial_grid_;                                              ///< @brief 均匀网格宽阶段
+    collision::ColliderBatch narrow_batch_;         ///< @brief 窄阶段批量检测的候选 (同一 first 的所有 second)
+    std::vector<std::uint64_t> narrow_hits_;        ///< @brief 窄阶段批量检测的命中位掩码
+
+    // --- 空间查询所用数据：物体索引只在主线程上重建 (物理帧结束时或 updateQueryIndex)，查询只读 ---
+    SpatialGrid query_grid_;                        ///< @brief 物体空间索引 (条目为 bodies_ 索引)
+    bool query_grid_dirty_ = true;                  ///< @brief 物体注册/注销后索引过期 (重建前查询改为逐个检测)
 
 public:
     PhysicsEngine() = default;
@@ -49,7 +130,13 @@ public:
     void registerCollisionLayer(engine::component::TileLayerComponent* layer);  ///< @brief 注册用于碰撞检测的 TileLayerComponent
     void unregisterCollisionLayer(engine::component::TileLayerComponent* layer);///< @brief 注销用于碰撞检测的 TileLayerComponent
 
-    void update(float delta_time);      ///< @brief 核心循环：更新所有注册的物理组件的状态
+    /**
+     * @brief 核心循环：更新所有注册的物理组件的状态。
+     * @param delta_time 帧时间。固定步长模式下会被累积，并按固定步长执行 0 到 max_substeps 个子步。
+     */
+    void update(float delta_time);
+    /// @brief 重建合并碰撞网格（注册/注销图层时自动调用，运行时修改了瓦片数据后需手动调用）
+    void rebuildCollisionGrid();
 
     // 设置器/获取器
     void setGravity(glm::vec2 gravity) { gravity_ = std::move(gravity); }   ///< @brief 设置全局重力加速度
@@ -58,22 +145,162 @@ public:
     float getMaxSpeed() const { return max_speed_; }                    ///< @brief 获取当前的最大速度
     void setWorldBounds(engine::utils::Rect world_bounds) { world_bounds_ = std::move(world_bounds); } ///< @brief 设置世界边界
     const std::optional<engine::utils::Rect>& getWorldBounds() const { return world_bounds_; }       ///< @brief 获取世界边界
+    void setFixedTimeStepEnabled(bool enabled) { fixed_time_step_enabled_ = enabled; }   ///< @brief 设置是否使用固定时间步长
+    bool isFixedTimeStepEnabled() const { return fixed_time_step_enabled_; }            ///< @brief 是否使用固定时间步长
+    void setFixedTimeStep(float fixed_time_step);                       ///< @brief 设置固定步长 (秒，必须为正数)
+    float getFixedTimeStep() const { return fixed_time_step_; }         ///< @brief 获取固定步长 (秒)
+    void setMaxSubsteps(int max_substeps);                              ///< @brief 设置每帧最多执行的子步数 (至少为1)
+    int getMaxSubsteps() const { return max_substeps_; }                ///< @brief 获取每帧最多执行的子步数
+    void setInterpolationEnabled(bool enabled) { interpolation_enabled_ = enabled; }    ///< @brief 设置是否进行渲染插值
+    bool isInterpolationEnabled() const { return interpolation_enabled_; }              ///< @brief 是否进行渲染插值
+    int getLastSubstepCount() const { return last_substep_count_; }     ///< @brief 获取上一帧执行的子步数
+    /**
+     * @brief 设置确定性模式。
+     * 开启后每次 update 忽略传入的帧时间，恰好执行一个固定步长 (不做渲染插值)，
+     * 并在每帧结束时把所有物体的状态混入滚动哈希。相同输入的两次运行，每帧的哈希都相同。
+     * @note 切换模式时会重置哈希和帧数。
+     */
+    void setDeterministic(bool deterministic);
+    bool isDeterministic() const { return deterministic_; }             ///< @brief 是否为确定性模式
+    std::uint64_t getStateHash() const { return state_hash_; }          ///< @brief 获取滚动状态哈希 (仅确定性模式下更新)
+    std::uint64_t getFrameCount() const { return frame_count_; }        ///< @brief 获取确定性模式下已模拟的帧数
+    const PhysicsStats& getStats() const { return stats_; }             ///< @brief 获取最近一帧的计数与各阶段耗时
+    void setThreadPool(engine::core::ThreadPool* thread_pool) { thread_pool_ = thread_pool; }  ///< @brief 设置工作线程池 (非拥有)
+    void setParallelEnabled(bool enabled) { parallel_enabled_ = enabled; }                     ///< @brief 设置是否并行积分
+    bool isParallelEnabled() const { return parallel_enabled_ && thread_pool_ != nullptr; }    ///< @brief 是否并行积分
+    void setParallelMinBodies(std::size_t min_bodies) { parallel_min_bodies_ = min_bodies; }  ///< @brief 设置触发并行的最少物体数
+    void setBroadphaseCellSize(float cell_size) { spatial_grid_.setCellSize(cell_size); }   ///< @brief 设置宽阶段网格单元尺寸
+    float getBroadphaseCellSize() const { return spatial_grid_.getCellSize(); }             ///< @brief 获取宽阶段网格单元尺寸
+    void setSleepEnabled(bool enabled) { sleep_enabled_ = enabled; }                        ///< @brief 设置是否允许物体休眠
+    bool isSleepEnabled() const { return sleep_enabled_; }                                  ///< @brief 是否允许物体休眠
+    void setSleepVelocityThreshold(float threshold) { sleep_velocity_threshold_ = threshold; }  ///< @brief 设置视为静止的速度阈值 (像素/秒)
+    void setTimeToSleep(float seconds) { time_to_sleep_ = seconds; }                        ///< @brief 设置进入休眠所需的静止时间 (秒)
+    float getTimeToSleep() const { return time_to_sleep_; }                                 ///< @brief 获取进入休眠所需的静止时间 (秒)
+    std::size_t getBodyCount() const { return bodies_.size(); }                             ///< @brief 获取注册的物体数量
+    std::size_t getSleepingBodyCount() const { return sleeping_body_count_; }               ///< @brief 获取上一帧结束时休眠的物体数量
+    std::size_t getActiveBodyCount() const { return bodies_.size() - sleeping_body_count_; }///< @brief 获取上一帧结束时活动的物体数量
+    std::size_t getFrozenBodyCount() const { return frozen_body_count_; }                   ///< @brief 获取上一帧结束时被冻结的物体数量
+    /**
+     * @brief 唤醒物体。
+     * @note 通常不需要手动调用：修改组件的速度、位置、施加力或与活动物体接触时，物体会自动唤醒。
+     */
+    void wakeUp(engine::component::PhysicsComponent* component);
+    bool isSleeping(const engine::component::PhysicsComponent* component) const;   ///< @brief 物体是否处于休眠状态
+
+    // --- 空间查询 (基于最近一次物理步骤结束时的物体位置，只包含启用且碰撞器激活的物体) ---
+    // 查询是只读的 (const)，可以在并行更新阶段 (如 AI) 的多个线程上同时调用，也可以在查询的回调中嵌套查询。
+    // 但查询期间不能有其它线程修改物理引擎 (注册/注销组件、执行 update)，场景的阶段划分保证了这一点。
+
+    /// @brief 需要时重建空间查询的物体索引 (只能在主线程调用；场景在并行阶段开始前调用，物理帧结束时也会自动调用)
+    void updateQueryIndex();
+    /**
+     * @brief 射线检测：返回射线命中的最近物体或 SOLID 瓦片。
+     * @param origin 起点。
+     * @param direction 方向 (无需归一化，零向量时返回空)。
+     * @param max_distance 最大距离 (必须为正的有限值，可以很大：遍历范围会裁剪到物体和瓦片所在的区域)。
+     * @param mask 只检测类别与掩码相交的物体。
+     * @param include_tiles 是否检测 SOLID 瓦片。
+     * @note 起点位于其内部的物体会被忽略 (例如从自身中心发出的射线不会命中自身)。
+     */
+    std::optional<RaycastHit> raycast(const glm::vec2& origin, const glm::vec2& direction, float max_distance,
+                                      std::uint32_t mask = CollisionLayer::ALL, bool include_tiles = true) const;
+    /// @brief 线段与瓦片检测：返回从 start 到 end 的线段上第一个 SOLID 瓦片 (可用于视线判断)
+    std::optional<RaycastHit> raycastTiles(const glm::vec2& start, const glm::vec2& end) const;
+    /**
+     * @brief 区域检测：对每个与区域重叠的物体调用一次回调。
+     * @param area 查询区域 (世界坐标)。
+     * @param mask 只报告类别与掩码相交的物体。
+     * @param callback 回调，参数为游戏对象。
+     * @return 报告的物体数量。
+     */
+    std::size_t overlapBox(const engine::utils::Rect& area, std::uint32_t mask,
+                           engine::utils::FunctionRef<void(engine::object::GameObject*)> callback) const;
+    /**
+     * @brief 最近邻查询：按距离从近到远，对最多 k 个物体调用回调。
+     * @param point 查询点。
+     * @param max_distance 查询半径 (到物体AABB的最近距离，必须为有限值)。
+     * @param k 最多报告的物体数量。
+     * @param mask 只报告类别与掩码相交的物体。
+     * @param callback 回调，参数为游戏对象和距离 (点位于物体内部时为0)。
+     * @return 报告的物体数量。
+     */
+    std::size_t queryNearest(const glm::vec2& point, float max_distance, std::size_t k, std::uint32_t mask,
+                             engine::utils::FunctionRef<void(engine::object::GameObject*, float)> callback) const;
+
     /// @brief 获取本帧检测到的所有 GameObject 碰撞对。(此列表在每次 update 开始时清空)
     const std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>>& getCollisionPairs() const {
         return collision_pairs_;
     };
-    /// @brief 获取本帧检测到的所有瓦片触发事件。(此列表在每次 update 开始时清空)
-    const std::vector<std::pair<engine::object::GameObject*, engine::component::TileType>>& getTileTriggerEvents() const {
+    /// @brief 获取本帧新开始的碰撞对（上一帧未接触）。
+    const std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>>& getCollisionBeginPairs() const {
+        return collision_begin_pairs_;
+    }
+    /// @brief 获取本帧持续中的碰撞对（上一帧已接触）。
+    const std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>>& getCollisionStayPairs() const {
+        return collision_stay_pairs_;
+    }
+    /// @brief 获取本帧结束的碰撞对（上一帧接触、本帧分离）。被销毁对象的接触会被直接丢弃，不产生结束事件。
+    const std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>>& getCollisionEndPairs() const {
+        return collision_end_pairs_;
+    }
+    /**
+     * @brief 获取本帧的瓦片触发器进入/离开事件。(此列表在每次 update 开始时清空)
+     * @note 只在物体的触发器掩码变化时产生事件；需要持续判断时直接读取 PhysicsComponent::getTileTriggers()。
+     *       被销毁对象的事件会被丢弃，不产生离开事件。
+     */
+    const std::vector<TileTriggerEvent>& getTileTriggerEvents() const {
         return tile_trigger_events_;
     };
 
 private:
+    void beginFrame();                  ///< @brief 帧内第一个物理步骤之前调用：清空本帧事件并收集物体状态
+    void step(float delta_time);        ///< @brief 执行一个物理步骤 (积分、瓦片碰撞、对象碰撞、瓦片触发)
+    void endFrame();                    ///< @brief 帧内所有物理步骤之后调用：生成接触事件并写回组件
+    /// @brief 单个物体的速度积分 (只写该物体自身的数据，可并行调用)，返回是否进行了积分
+    bool integrateBody(std::size_t index, float delta_time);
+    /// @brief 按步长额外模拟物体待补上的时间 (只写该物体自身的数据，可并行调用)，返回查询瓦片的次数
+    std::uint32_t catchUpBody(std::size_t index, float delta_time);
+    void clearFrameEvents();            ///< @brief 清空本帧的碰撞对和事件列表 (不影响接触缓存)
+    void applyInterpolation(float alpha);   ///< @brief 根据插值系数设置各物体 Transform 的渲染偏移
+    void updateStateHash();             ///< @brief 把所有物体的当前状态混入滚动哈希 (FNV-1a)
+    void gatherBodies();                ///< @brief 物理步骤开始时，从组件收集物体状态到 SoA 数组
+    /// @brief 固定步长模式下每帧调用：把组件上本帧的力按帧时间换算为冲量累积起来，并清除组件的力
+    void accumulateImpulses(float delta_time);
+    void scatterBodies();               ///< @brief 物理步骤结束时，将 SoA 数组中的结果写回组件
+    /// @brief 获取物体当前的世界AABB (基于 SoA 数组中的位置)
+    engine::utils::Rect getBodyAABB(std::size_t index) const {
+        return {bodies_.position[index] + bodies_.aabb_offset[index], bodies_.aabb_size[index]};
+    }
+    /// @brief 获取物体在本步中扫过的区域 (起点AABB与终点AABB的并集)
+    engine::utils::Rect getSweptAABB(std::size_t index) const;
+    /// @brief 区域查询去重：单元格是否为物体与查询区域共同覆盖的第一个单元格 (只在这个单元格中报告物体)
+    bool isFirstQueryCell(std::size_t index, const engine::utils::Rect& area, int cell_x, int cell_y) const;
+    /// @brief 物体是否可以被空间查询报告 (启用、碰撞器激活且类别与掩码相交)
+    bool isQueryable(std::size_t index, std::uint32_t mask) const;
     void checkObjectCollisions();       ///< @brief 检测并处理对象之间的碰撞，并记录需要游戏逻辑处理的碰撞对。
-    /// @brief 检测并处理游戏对象和瓦片层之间的碰撞。
-    void resolveTileCollisions(engine::component::PhysicsComponent* pc, float delta_time);
-    /// @brief 处理可移动物体与SOLID物体的碰撞。
-    void resolveSolidObjectCollisions(engine::object::GameObject* move_obj, engine::object::GameObject* solid_obj);
-    void applyWorldBounds(engine::component::PhysicsComponent* pc);     ///< @brief 应用世界边界，限制物体移动范围
+    /**
+     * @brief 处理一个候选对 (checkObjectCollisions 的窄阶段)。
+     * @param batch_index b 在本块批量检测结果中的序号。
+     * @param a_moved 本块中 a 是否已被 SOLID 物体推开 (推开后批量结果失效，改为逐对检测)，会被更新。
+     */
+    void checkObjectPair(std::uint32_t a, std::uint32_t b, std::size_t batch_index, bool& a_moved);
+    void updateContacts();              ///< @brief 对比上一帧的接触缓存，生成开始/持续/结束碰撞事件。
+    void removeContactsOf(const engine::object::GameObject* obj);  ///< @brief 从接触缓存和本帧各事件列表中移除与指定对象相关的记录
+    /// @brief 生成与两个对象顺序无关的接触键值
+    static ContactKey makeContactKey(const engine::object::GameObject* a, const engine::object::GameObject* b);
+    /// @brief 检测并处理游戏对象和瓦片层之间的碰撞 (只写该物体自身的数据，可并行调用)，返回查询瓦片的次数。
+    std::uint32_t resolveTileCollisions(std::size_t index, float delta_time);
+    /**
+     * @brief 处理可移动物体与SOLID物体的碰撞。
+     * 先根据本步位移做扫掠检测 (防止高速穿透)，起始时已重叠的情况再用最小平移向量推出。
+     * @return 是否发生了碰撞
+     */
+    bool resolveSolidObjectCollisions(std::size_t move_index, std::size_t solid_index);
+    void applyWorldBounds(std::size_t index);     ///< @brief 应用世界边界，限制物体移动范围
+    void updateSleepStates(float delta_time);   ///< @brief 根据速度和接触情况更新休眠计时，静止足够久的物体进入休眠
+    void wakeBody(std::size_t index);           ///< @brief 唤醒指定序号的物体并重置休眠计时 (冻结的物体不会被唤醒)
+    void wakeBodyOf(const engine::object::GameObject* obj);   ///< @brief 唤醒属于指定游戏对象的物体 (如果有)
+    void wakeBodiesInArea(const engine::utils::Rect& area);   ///< @brief 唤醒AABB与指定区域接触的所有休眠物体
 
     /**
      * @brief 根据瓦片类型和指定宽度x坐标，计算瓦片上对应y坐标。
@@ -85,9 +312,10 @@ private:
     float getTileHeightAtWidth(float width, engine::component::TileType type, glm::vec2 tile_size);
 
     /**
-     * @brief 检测所有游戏对象与瓦片层的触发器类型瓦片碰撞，并记录触发事件。(位移处理完毕后再调用)
+     * @brief 更新所有物体当前覆盖的瓦片触发器掩码。(位移处理完毕后再调用)
      */ 
-    void checkTileTriggers();   
+    void checkTileTriggers();
+    void updateTileTriggerEvents();     ///< @brief 对比触发器掩码的变化，生成进入/离开事件
 };
 
 } // namespace engine::physics
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+namespace engine::physics {
+
+/**
+ * @brief 物理引擎最近一帧的统计数据（计数与各阶段耗时）。
+ *
+ * 每次 PhysicsEngine::update 开始时清零，多个子步的数据会累加。
+ * 本帧没有执行子步时，除物体数量外均为 0。
+ */
+struct PhysicsStats {
+    // --- 计数 ---
+    int substeps = 0;                       ///< @brief 执行的子步数
+    std::size_t bodies = 0;                 ///< @brief 注册的物体数量
+    std::size_t sleeping_bodies = 0;        ///< @brief 休眠的物体数量 (包括冻结的物体)
+    std::size_t frozen_bodies = 0;          ///< @brief 离开活动区域而被冻结的物体数量
+    std::uint32_t bodies_integrated = 0;    ///< @brief 积分的物体次数 (各子步累加)
+    std::uint32_t tile_probes = 0;          ///< @brief 瓦片查询次数 (瓦片碰撞与瓦片触发器)
+    std::uint32_t broadphase_pairs = 0;     ///< @brief 宽阶段候选对数量
+    std::uint32_t narrowphase_tests = 0;    ///< @brief 精确检测次数 (通过类别/掩码与休眠过滤的候选对)
+    std::uint32_t narrowphase_hits = 0;     ///< @brief 精确检测命中次数
+    std::uint32_t solid_resolutions = 0;    ///< @brief 与SOLID物体的碰撞处理次数
+    std::uint32_t collision_events = 0;     ///< @brief 开始/持续/结束碰撞事件总数
+    std::uint32_t trigger_events = 0;       ///< @brief 瓦片触发器进入/离开事件数量
+
+    // --- 耗时 (毫秒) ---
+    double integrate_ms = 0.0;              ///< @brief 速度积分
+    double tile_resolve_ms = 0.0;           ///< @brief 瓦片碰撞与世界边界
+    double object_pairs_ms = 0.0;           ///< @brief 对象碰撞 (宽阶段 + 精确检测 + SOLID处理)
+    double triggers_ms = 0.0;               ///< @brief 瓦片触发器检测
+    double total_ms = 0.0;                  ///< @brief update 总耗时 (含收集、写回和事件生成)
+};
+
+} // namespace engine::physics
@@ -0,0 +1,135 @@
+#include "spatial_grid.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/common.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::physics {
+
+SpatialGrid::SpatialGrid(float cell_size) {
+    setCellSize(cell_size);
+}
+
+void SpatialGrid::clear() {
+    entries_.clear();
+}
+
+void SpatialGrid::insert(std::uint32_t id, const engine::utils::Rect& aabb) {
+    // 计算AABB覆盖的单元格范围（右、下边缘恰好落在单元格边界时会多覆盖一格，不影响正确性）
+    auto start_x = toCell(aabb.position.x);
+    auto start_y = toCell(aabb.position.y);
+    auto end_x = toCell(aabb.position.x + aabb.size.x);
+    auto end_y = toCell(aabb.position.y + aabb.size.y);
+
+    for (int x = start_x; x <= end_x; ++x) {
+        for (int y = start_y; y <= end_y; ++y) {
+            entries_.push_back({makeKey(x, y), id});
+        }
+    }
+}
+
+void SpatialGrid::findPairs(std::vector<std::pair<std::uint32_t, std::uint32_t>>& out_pairs) {
+    out_pairs.clear();
+    pair_keys_.clear();
+
+    // 按 (单元格, 物体序号) 排序，使同一单元格内的物体相邻且序号递增
+    build();
+
+    // 同一单元格内的物体两两组成候选对
+    size_t run_start = 0;
+    while (run_start < entries_.size()) {
+        size_t run_end = run_start + 1;
+        while (run_end < entries_.size() && entries_[run_end].key == entries_[run_start].key) {
+            ++run_end;
+        }
+        for (size_t i = run_start; i < run_end; ++i) {
+            for (size_t j = i + 1; j < run_end; ++j) {
+                pair_keys_.push_back((static_cast<std::uint64_t>(entries_[i].id) << 32) | entries_[j].id);
+            }
+        }
+        run_start = run_end;
+    }
+
+    // 跨越多个单元格的物体对会被重复记录，排序去重后即为 (first, second) 字典序
+    std::sort(pair_keys_.begin(), pair_keys_.end());
+    pair_keys_.erase(std::unique(pair_keys_.begin(), pair_keys_.end()), pair_keys_.end());
+
+    out_pairs.reserve(pair_keys_.size());
+    for (auto key : pair_keys_) {
+        out_pairs.emplace_back(static_cast<std::uint32_t>(key >> 32), static_cast<std::uint32_t>(key & 0xFFFFFFFFu));
+    }
+}
+
+void SpatialGrid::build() {
+    std::sort(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
+        return a.key != b.key ? a.key < b.key : a.id < b.id;
+    });
+    // 记录网格范围，查询时据此裁剪
+    min_cell_ = {0, 0};
+    max_cell_ = {-1, -1};
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+        glm::ivec2 cell = {cellX(entries_[i].key), cellY(entries_[i].key)};
+        min_cell_ = i == 0 ? cell : glm::min(min_cell_, cell);
+        max_cell_ = i == 0 ? cell : glm::max(max_cell_, cell);
+    }
+}
+
+engine::utils::Rect SpatialGrid::getBounds() const {
+    if (entries_.empty()) return {{0.0f, 0.0f}, {0.0f, 0.0f}};
+    return {glm::vec2(min_cell_) * cell_size_, glm::vec2(max_cell_ - min_cell_ + 1) * cell_size_};
+}
+
+int SpatialGrid::toCell(float coord) const {
+    constexpr float limit = static_cast<float>(1 << 30);
+    auto cell = std::floor(coord / cell_size_);
+    if (std::isnan(cell)) return 0;
+    return static_cast<int>(std::clamp(cell, -limit, limit));
+}
+
+void SpatialGrid::query(const engine::utils::Rect& area, engine::utils::FunctionRef<void(std::uint32_t, int, int)> callback) const {
+    if (entries_.empty()) return;
+    // 只需查询区域与网格范围相交的部分
+    auto start_x = std::max(toCell(area.position.x), min_cell_.x);
+    auto start_y = std::max(toCell(area.position.y), min_cell_.y);
+    auto end_x = std::min(toCell(area.position.x + area.size.x), max_cell_.x);
+    auto end_y = std::min(toCell(area.position.y + area.size.y), max_cell_.y);
+    if (start_x > end_x || start_y > end_y) return;
+
+    // 查询区域覆盖的单元格比条目还多时，直接遍历所有条目更快
+    auto cell_count = static_cast<std::size_t>(end_x - start_x + 1) * static_cast<std::size_t>(end_y - start_y + 1);
+    if (cell_count > entries_.size()) {
+        for (const auto& entry : entries_) {
+            auto cell_x = cellX(entry.key);
+            auto cell_y = cellY(entry.key);
+            if (cell_x >= start_x && cell_x <= end_x && cell_y >= start_y && cell_y <= end_y) {
+                callback(entry.id, cell_x, cell_y);
+            }
+        }
+        return;
+    }
+    for (int x = start_x; x <= end_x; ++x) {
+        for (int y = start_y; y <= end_y; ++y) {
+            queryCell(x, y, [&](std::uint32_t id) { callback(id, x, y); });
+        }
+    }
+}
+
+void SpatialGrid::queryCell(int cell_x, int cell_y, engine::utils::FunctionRef<void(std::uint32_t)> callback) const {
+    auto key = makeKey(cell_x, cell_y);
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), key, [](const Entry& entry, std::uint64_t k) {
+        return entry.key < k;
+    });
+    for (; it != entries_.end() && it->key == key; ++it) {
+        callback(it->id);
+    }
+}
+
+void SpatialGrid::setCellSize(float cell_size) {
+    if (cell_size <= 0.0f) {
+        spdlog::warn("SpatialGrid 单元格尺寸必须为正数，忽略设置值: {}", cell_size);
+        return;
+    }
+    cell_size_ = cell_size;
+}
+
+} // namespace engine::physics
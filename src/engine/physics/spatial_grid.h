@@ -0,0 +1,90 @@
+#pragma once
+#include "../utils/math.h"
+#include "../utils/function_ref.h"
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <glm/vec2.hpp>
+
+namespace engine::physics {
+
+/**
+ * @brief 均匀网格宽阶段（broadphase），用于快速筛选可能发生碰撞的物体对。
+ *
+ * 每帧重建：先清空，再依次插入所有物体的AABB，最后统一计算候选碰撞对。
+ * 只有至少共享一个网格单元的物体才会成为候选对，从而避免 O(n²) 的两两检测。
+ * 内部容器在多帧之间复用，稳定运行时不会产生额外的内存分配。
+ * 也可以作为区域查询的空间索引：插入完成后调用 build()，之后即可用 query()/queryCell() 查询。
+ * 查询只读取网格，build() 之后可以在多个线程上同时查询。
+ */
+class SpatialGrid final {
+private:
+    /// @brief 网格条目：(单元格键值, 物体序号)
+    struct Entry {
+        std::uint64_t key;
+        std::uint32_t id;
+    };
+
+    float cell_size_ = 64.0f;               ///< @brief 单元格尺寸（像素）
+    glm::ivec2 min_cell_ = {0, 0};          ///< @brief 所有条目覆盖的最小单元格坐标 (build 时计算)
+    glm::ivec2 max_cell_ = {-1, -1};        ///< @brief 所有条目覆盖的最大单元格坐标 (没有条目时小于 min_cell_)
+    std::vector<Entry> entries_;            ///< @brief 所有物体覆盖的单元格条目（排序后按单元格分组）
+    std::vector<std::uint64_t> pair_keys_;  ///< @brief 候选对的压缩键值 (小序号 << 32 | 大序号)，用于排序去重
+
+public:
+    /**
+     * @brief 构造函数
+     * @param cell_size 单元格尺寸（像素），通常取瓦片尺寸的数倍，与常见物体大小相当即可
+     */
+    explicit SpatialGrid(float cell_size = 64.0f);
+
+    // 禁止拷贝和移动
+    SpatialGrid(const SpatialGrid&) = delete;
+    SpatialGrid& operator=(const SpatialGrid&) = delete;
+    SpatialGrid(SpatialGrid&&) = delete;
+    SpatialGrid& operator=(SpatialGrid&&) = delete;
+
+    void clear();                                               ///< @brief 清空网格（保留容量）
+    void insert(std::uint32_t id, const engine::utils::Rect& aabb);   ///< @brief 插入一个物体的AABB，id 应按递增顺序插入
+
+    /**
+     * @brief 计算所有共享单元格的候选物体对。
+     * @param out_pairs 输出容器（会先被清空），每一对满足 first < second，
+     *                  且整体按 (first, second) 字典序排列、无重复。
+     *                  因此遍历顺序与原先的双层循环 (i, j > i) 完全一致。
+     */
+    void findPairs(std::vector<std::pair<std::uint32_t, std::uint32_t>>& out_pairs);
+
+    void build();       ///< @brief 插入完成后整理条目，使 query()/queryCell() 可用 (findPairs 也会完成同样的整理)
+    /**
+     * @brief 查询与区域共享单元格的所有物体 (需先调用 build 或 findPairs)。
+     *
+     * 只遍历区域与网格范围相交的单元格，区域再大 (例如半径为 FLT_MAX) 也不会越界或遍历空单元格。
+     * @param area 查询区域
+     * @param callback 回调，参数为物体序号和所在单元格坐标。跨越多个单元格的物体会被报告多次，
+     *                 调用者可以只接受 "物体与查询区域共同覆盖的第一个单元格" 中的报告来去重。
+     */
+    void query(const engine::utils::Rect& area, engine::utils::FunctionRef<void(std::uint32_t, int, int)> callback) const;
+    /// @brief 查询指定单元格中的所有物体 (需先调用 build 或 findPairs)
+    void queryCell(int cell_x, int cell_y, engine::utils::FunctionRef<void(std::uint32_t)> callback) const;
+
+    void setCellSize(float cell_size);                          ///< @brief 设置单元格尺寸（必须为正数）
+    float getCellSize() const { return cell_size_; }            ///< @brief 获取单元格尺寸
+    bool empty() const { return entries_.empty(); }             ///< @brief 是否没有任何条目
+    /// @brief 获取所有条目覆盖的单元格组成的世界区域 (需先调用 build，没有条目时尺寸为0)
+    engine::utils::Rect getBounds() const;
+    /// @brief 坐标所在的单元格序号 (钳制在 ±2^30 之内，超大坐标也不会溢出)
+    int toCell(float coord) const;
+
+private:
+    /// @brief 将单元格坐标压缩为一个64位键值
+    static std::uint64_t makeKey(int cell_x, int cell_y) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell_x)) << 32) |
+                static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell_y));
+    }
+    /// @brief 从键值中取出单元格坐标
+    static int cellX(std::uint64_t key) { return static_cast<int>(static_cast<std::int32_t>(key >> 32)); }
+    static int cellY(std::uint64_t key) { return static_cast<int>(static_cast<std::int32_t>(key & 0xFFFFFFFFu)); }
+};
+
+} // namespace engine::physics
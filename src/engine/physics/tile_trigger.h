@@ -0,0 +1,18 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::physics {
+
+/**
+ * @brief 瓦片触发器类型（位掩码）。
+ *
+ * 每个物体持有一个掩码，表示它当前覆盖了哪些类型的触发器瓦片。
+ * 物理引擎只在掩码变化时产生进入/离开事件，游戏逻辑也可以直接读取当前掩码。
+ */
+namespace TileTrigger {
+    constexpr std::uint8_t NONE   = 0;
+    constexpr std::uint8_t HAZARD = 1u << 0;    ///< @brief 危险瓦片（尖刺、火焰等）
+    constexpr std::uint8_t LADDER = 1u << 1;    ///< @brief 梯子瓦片
+} // namespace TileTrigger
+
+} // namespace engine::physics
@@ -5,7 +5,15 @@
 namespace engine::render {
 
 Animation::Animation(std::string_view name, bool loop)
-    : name_(name), loop_(loop) {}
+    : loop_(loop) {
+    setName(name);
+}
+
+void Animation::setName(std::string_view name) {
+    auto& interner = engine::utils::StringInterner::global();
+    name_id_ = interner.intern(name);
+    name_ = interner.view(name_id_);
+}
 
 void Animation::addFrame(SDL_FRect source_rect, float duration) {
     if (duration <= 0.0f) {
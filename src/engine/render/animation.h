@@ -1,7 +1,7 @@
 #pragma once
+#include "../utils/string_interner.h"
 #include <SDL3/SDL_rect.h>
 #include <vector>
-#include <string>
 #include <string_view>
 
 namespace engine::render {
@@ -23,7 +23,8 @@ struct AnimationFrame {
  */
 class Animation final {
 private:
-    std::string name_;                      ///< @brief 动画的名称 (例如, "walk", "idle")。
+    std::string_view name_;                 ///< @brief 动画的名称 (例如, "walk", "idle")，指向驻留池中的字符串。
+    engine::utils::StringId name_id_ = engine::utils::EMPTY_STRING_ID;  ///< @brief 名称ID
     std::vector<AnimationFrame> frames_;    ///< @brief 动画帧列表
     float total_duration_ = 0.0f;           ///< @brief 动画的总持续时间（秒）
     bool loop_ = true;                      ///< @brief 默认动画是循环的
@@ -60,13 +61,14 @@ public:
 
     // --- Setters and Getters ---
     std::string_view getName() const { return name_; }                        ///< @brief 获取动画名称。
+    engine::utils::StringId getNameId() const { return name_id_; }              ///< @brief 获取动画名称ID (驻留字符串ID)。
     const std::vector<AnimationFrame>& getFrames() const { return frames_; }    ///< @brief 获取动画帧列表。
     size_t getFrameCount() const { return frames_.size(); }                     ///< @brief 获取帧数量。
     float getTotalDuration() const { return total_duration_; }                  ///< @brief 获取动画的总持续时间（秒）。
     bool isLooping() const { return loop_; }                                    ///< @brief 检查动画是否循环播放。
     bool isEmpty() const { return frames_.empty(); }                            ///< @brief 检查动画是否没有帧。
 
-    void setName(std::string_view name) { name_ = name; }                       ///< @brief 设置动画名称。
+    void setName(std::string_view name);                                        ///< @brief 设置动画名称。
     void setLooping(bool loop) { loop_ = loop; }                                ///< @brief 设置动画是否循环播放。  
 
 };
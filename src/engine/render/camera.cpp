@@ -19,10 +19,10 @@ void Camera::setPosition(glm::vec2 position) {
     clampPosition();
 }
 
-void Camera::update(float delta_time)
+void Camera::update(float delta_time, const engine::component::TransformComponent* target)
 {
-    if (target_ == nullptr)  return;
-    glm::vec2 target_pos = target_->getPosition();
+    if (target == nullptr)  return;
+    glm::vec2 target_pos = target->getRenderPosition();    // 使用插值后的渲染位置，避免跟随时抖动
     glm::vec2 desired_position = target_pos - viewport_size_ / 2.0f;      // 计算目标位置 (让目标位于视口中心)
 
     // 计算当前位置与目标位置的距离
@@ -54,16 +54,39 @@ void Camera::setLimitBounds(std::optional<engine::utils::Rect> limit_bounds)
     clampPosition(); // 设置边界后，立即应用限制
 }
 
-void Camera::setTarget(engine::component::TransformComponent *target)
+void Camera::setTarget(engine::object::ObjectHandle target)
 {
     target_ = target;
 }
 
-engine::component::TransformComponent *Camera::getTarget() const
+engine::object::ObjectHandle Camera::getTarget() const
 {
     return target_;
 }
 
+void Camera::setActivityMargin(float margin)
+{
+    if (margin < 0.0f) {
+        spdlog::warn("活动区域扩展距离不能为负数，忽略设置值: {}", margin);
+        return;
+    }
+    activity_margin_ = margin;
+}
+
+void Camera::setInactiveUpdateInterval(int interval)
+{
+    if (interval < 0) {
+        spdlog::warn("区域外对象的更新间隔不能为负数，忽略设置值: {}", interval);
+        return;
+    }
+    inactive_update_interval_ = interval;
+}
+
+engine::utils::Rect Camera::getActivityRegion() const
+{
+    return {position_ - glm::vec2(activity_margin_), viewport_size_ + glm::vec2(activity_margin_ * 2.0f)};
+}
+
 const glm::vec2& Camera::getPosition() const {
     return position_;
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "../utils/math.h"
+#include "../object/object_handle.h"
 #include <optional>
 
 namespace engine::component {
@@ -18,7 +19,12 @@ private:
     glm::vec2 position_;                                                     ///< @brief 相机左上角的世界坐标
     std::optional<engine::utils::Rect> limit_bounds_;                        ///< @brief 限制相机的移动范围，空值表示不限制
     float smooth_speed_ = 5.0f;                                              ///< @brief 相机移动的平滑速度
-    engine::component::TransformComponent* target_ = nullptr;                ///< @brief 跟随目标变换组件，空值表示不跟随
+    engine::object::ObjectHandle target_;                                    ///< @brief 跟随目标对象的句柄，无效句柄表示不跟随
+
+    // --- 活动区域：视口向外扩展 margin 的矩形，区域外的对象由场景冻结或降频更新 ---
+    bool activity_culling_enabled_ = false;                                  ///< @brief 是否启用活动区域剔除
+    float activity_margin_ = 128.0f;                                         ///< @brief 活动区域在视口四周扩展的距离 (像素)
+    int inactive_update_interval_ = 0;                                       ///< @brief 区域外对象每隔多少帧更新一次 (逻辑和物理都补上间隔内的时间)，0 表示完全冻结
 
 public:
     /**
@@ -31,7 +37,12 @@ public:
            glm::vec2 position = glm::vec2(0.0f, 0.0f), 
            std::optional<engine::utils::Rect> limit_bounds = std::nullopt);
     
-    void update(float delta_time);                                          ///< @brief 更新相机位置
+    /**
+     * @brief 更新相机位置
+     * @param delta_time 帧间隔
+     * @param target 跟随目标的变换组件 (由场景根据 getTarget() 句柄解析，为空时不跟随)
+     */
+    void update(float delta_time, const engine::component::TransformComponent* target);
     void move(const glm::vec2& offset);                                     ///< @brief 移动相机
 
     glm::vec2 worldToScreen(const glm::vec2& world_pos) const;              ///< @brief 世界坐标转屏幕坐标
@@ -40,12 +51,19 @@ public:
 
     void setPosition(glm::vec2 position);                                   ///< @brief 设置相机位置
     void setLimitBounds(std::optional<engine::utils::Rect> limit_bounds);   ///< @brief 设置限制相机的移动范围
-    void setTarget(engine::component::TransformComponent* target);          ///< @brief 设置跟随目标变换组件
+    void setTarget(engine::object::ObjectHandle target);                    ///< @brief 设置跟随目标对象 (对象需要有变换组件)
+    void setActivityCullingEnabled(bool enabled) { activity_culling_enabled_ = enabled; }   ///< @brief 设置是否启用活动区域剔除
+    void setActivityMargin(float margin);                                   ///< @brief 设置活动区域的扩展距离 (不能为负)
+    void setInactiveUpdateInterval(int interval);                           ///< @brief 设置区域外对象的更新间隔帧数 (0 表示冻结)
 
     const glm::vec2& getPosition() const;                                   ///< @brief 获取相机位置
     std::optional<engine::utils::Rect> getLimitBounds() const;              ///< @brief 获取限制相机的移动范围
     glm::vec2 getViewportSize() const;                                      ///< @brief 获取视口大小
-    engine::component::TransformComponent* getTarget() const;               ///< @brief 获取跟随目标变换组件
+    engine::object::ObjectHandle getTarget() const;                         ///< @brief 获取跟随目标对象的句柄
+    bool isActivityCullingEnabled() const { return activity_culling_enabled_; }     ///< @brief 是否启用活动区域剔除
+    float getActivityMargin() const { return activity_margin_; }                    ///< @brief 获取活动区域的扩展距离
+    int getInactiveUpdateInterval() const { return inactive_update_interval_; }     ///< @brief 获取区域外对象的更新间隔帧数
+    engine::utils::Rect getActivityRegion() const;                          ///< @brief 获取活动区域 (世界坐标，视口四周扩展 margin)
 
     // 禁用拷贝和移动语义
     Camera(const Camera&) = delete;
@@ -1,7 +1,7 @@
 #pragma once
+#include "../utils/string_interner.h"
 #include <SDL3/SDL_rect.h>   // 用于 SDL_FRect
 #include <optional>          // 用于 std::optional 表示可选的源矩形
-#include <string>
 #include <string_view>
 
 namespace engine::render {
@@ -15,7 +15,7 @@ namespace engine::render {
  */
 class Sprite final{
 private:
-    std::string texture_id_;                      ///< @brief 纹理资源的标识符
+    std::string_view texture_id_;                 ///< @brief 纹理资源的标识符 (指向驻留池中的字符串，创建精灵时无需复制路径)
     std::optional<SDL_FRect> source_rect_;        ///< @brief 可选：要绘制的纹理部分
     bool is_flipped_ = false;                     ///< @brief 是否水平翻转
 
@@ -33,7 +33,7 @@ public:
      * @param is_flipped 是否水平翻转
      */
     Sprite(std::string_view texture_id, const std::optional<SDL_FRect>& source_rect = std::nullopt, bool is_flipped = false)
-        : texture_id_(texture_id),
+        : texture_id_(engine::utils::StringInterner::global().view(engine::utils::internString(texture_id))),
           source_rect_(source_rect),
           is_flipped_(is_flipped)
     {}
@@ -43,7 +43,7 @@ public:
     const std::optional<SDL_FRect>& getSourceRect() const { return source_rect_; }                      ///< @brief 获取源矩形 (如果使用整个纹理则为 std::nullopt)
     bool isFlipped() const { return is_flipped_; }                                                      ///< @brief 获取是否水平翻转
 
-    void setTextureId(std::string_view texture_id) { texture_id_ = std::string(texture_id); }                      ///< @brief 设置纹理 ID
+    void setTextureId(std::string_view texture_id) { texture_id_ = engine::utils::StringInterner::global().view(engine::utils::internString(texture_id)); }  ///< @brief 设置纹理 ID
     void setSourceRect(std::optional<SDL_FRect> source_rect) { source_rect_ = std::move(source_rect); } ///< @brief 设置源矩形 (如果使用整个纹理则为 std::nullopt)
     void setFlipped(bool flipped) { is_flipped_ = flipped; }                                            ///< @brief 设置是否水平翻转
 
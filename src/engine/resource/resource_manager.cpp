@@ -51,6 +51,14 @@ void ResourceManager::clearTextures() {
     texture_manager_->clearTextures();
 }
 
+bool ResourceManager::decodeTexture(std::string_view file_path) {
+    return texture_manager_->decodeTexture(file_path);
+}
+
+std::size_t ResourceManager::uploadDecodedTextures() {
+    return texture_manager_->uploadDecodedTextures();
+}
+
 // --- 音频接口实现 ---
 Mix_Chunk* ResourceManager::loadSound(std::string_view file_path) {
     return audio_manager_->loadSound(file_path);
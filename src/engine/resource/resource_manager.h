@@ -53,6 +53,8 @@ public:
     void unloadTexture(std::string_view file_path);          ///< @brief 卸载指定的纹理资源
     glm::vec2 getTextureSize(std::string_view file_path);    ///< @brief 获取指定纹理的尺寸
     void clearTextures();                                      ///< @brief 清空所有纹理资源
+    bool decodeTexture(std::string_view file_path);           ///< @brief 在后台解码图片 (线程安全)，之后在主线程上传
+    std::size_t uploadDecodedTextures();                      ///< @brief 把已解码的图片上传为纹理 (主线程)，返回上传的数量
 
     // -- Sound Effects (Chunks) --
     Mix_Chunk* loadSound(std::string_view file_path);         ///< @brief 载入音效资源
@@ -20,26 +20,81 @@ SDL_Texture* TextureManager::loadTexture(std::string_view file_path) {
         return it->second.get();
     }
 
-    // 如果没加载则尝试加载纹理
-    SDL_Texture* raw_texture = IMG_LoadTexture(renderer_, file_path.data());    // 通过.data()获取const char*的指针
-
-    // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
-    if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
-        spdlog::warn("无法设置纹理缩放模式为最邻近插值");
+    // 如果已经在后台解码，则只需上传；否则直接加载纹理
+    std::unique_ptr<SDL_Surface, SDLSurfaceDeleter> surface;
+    {
+        std::lock_guard lock(decode_mutex_);
+        if (auto node = decoded_surfaces_.extract(std::string(file_path)); !node.empty()) {
+            surface = std::move(node.mapped());
+        }
     }
-
+    SDL_Texture* raw_texture = surface ? SDL_CreateTextureFromSurface(renderer_, surface.get())
+                                       : IMG_LoadTexture(renderer_, file_path.data());    // 通过.data()获取const char*的指针
     if (!raw_texture) {
         spdlog::error("加载纹理失败: '{}': {}", file_path, SDL_GetError());
         return nullptr;
     }
+    return addTexture(file_path, raw_texture);
+}
+
+SDL_Texture* TextureManager::addTexture(std::string_view file_path, SDL_Texture* raw_texture) {
+    // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
+    if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
+        spdlog::warn("无法设置纹理缩放模式为最邻近插值");
+    }
 
     // 使用带有自定义删除器的 unique_ptr 存储加载的纹理
     textures_.emplace(file_path, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_texture));
+    {
+        std::lock_guard lock(decode_mutex_);
+        loaded_paths_.emplace(file_path);
+    }
     spdlog::debug("成功加载并缓存纹理: {}", file_path);
 
     return raw_texture;
 }
 
+bool TextureManager::decodeTexture(std::string_view file_path) {
+    std::string path(file_path);
+    {
+        std::lock_guard lock(decode_mutex_);
+        if (loaded_paths_.contains(path) || decoded_surfaces_.contains(path)) return true;
+    }
+
+    // 解码 (文件读取和图片解码) 不持有锁，多个线程可以同时解码不同的图片
+    SDL_Surface* raw_surface = IMG_Load(path.c_str());
+    if (!raw_surface) {
+        spdlog::error("解码图片失败: '{}': {}", file_path, SDL_GetError());
+        return false;
+    }
+    std::unique_ptr<SDL_Surface, SDLSurfaceDeleter> surface(raw_surface);
+
+    std::lock_guard lock(decode_mutex_);
+    decoded_surfaces_.try_emplace(std::move(path), std::move(surface));     // 已被其它线程解码时丢弃本次结果
+    spdlog::trace("已解码图片: {}", file_path);
+    return true;
+}
+
+std::size_t TextureManager::uploadDecodedTextures() {
+    decltype(decoded_surfaces_) surfaces;
+    {
+        std::lock_guard lock(decode_mutex_);
+        surfaces.swap(decoded_surfaces_);
+    }
+    std::size_t count = 0;
+    for (auto& [path, surface] : surfaces) {
+        if (textures_.contains(path)) continue;     // 解码期间已经同步加载过
+        SDL_Texture* raw_texture = SDL_CreateTextureFromSurface(renderer_, surface.get());
+        if (!raw_texture) {
+            spdlog::error("上传纹理失败: '{}': {}", path, SDL_GetError());
+            continue;
+        }
+        addTexture(path, raw_texture);
+        ++count;
+    }
+    return count;
+}
+
 SDL_Texture* TextureManager::getTexture(std::string_view file_path) {
     // 查找现有纹理
     auto it = textures_.find(std::string(file_path));
@@ -74,6 +129,8 @@ void TextureManager::unloadTexture(std::string_view file_path) {
     if (it != textures_.end()) {
         spdlog::debug("卸载纹理: {}", file_path);
         textures_.erase(it); // unique_ptr 通过自定义删除器处理删除
+        std::lock_guard lock(decode_mutex_);
+        loaded_paths_.erase(std::string(file_path));
     } else {
         spdlog::warn("尝试卸载不存在的纹理: {}", file_path);
     }
@@ -84,6 +141,9 @@ void TextureManager::clearTextures() {
         spdlog::debug("正在清除所有 {} 个缓存的纹理。", textures_.size());
         textures_.clear(); // unique_ptr 处理所有元素的删除
     }
+    std::lock_guard lock(decode_mutex_);
+    loaded_paths_.clear();
+    decoded_surfaces_.clear();
 }
 
 } // namespace engine::resource
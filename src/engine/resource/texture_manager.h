@@ -4,6 +4,8 @@
 #include <string>       // 用于 std::string
 #include <string_view> // 用于 std::string_view
 #include <unordered_map> // 用于 std::unordered_map
+#include <unordered_set>
+#include <mutex>
 #include <SDL3/SDL_render.h> // 用于 SDL_Texture 和 SDL_Renderer
 #include <glm/glm.hpp>
 
@@ -14,6 +16,7 @@ namespace engine::resource {
  *
  * 在构造时初始化。使用文件路径作为键，确保纹理只加载一次并正确释放。
  * 依赖于一个有效的 SDL_Renderer，构造失败会抛出异常。
+ * 除 decodeTexture() 可以在任意线程调用外，其余方法只能在主线程 (渲染线程) 调用。
  */
 class TextureManager final{
     friend class ResourceManager;
@@ -33,6 +36,18 @@ private:
 
     SDL_Renderer* renderer_ = nullptr; // 指向主渲染器的非拥有指针
 
+    // --- 后台解码：工作线程只把图片解码为 SDL_Surface，上传为纹理 (需要渲染器) 在主线程进行 ---
+    struct SDLSurfaceDeleter {
+        void operator()(SDL_Surface* surface) const {
+            if (surface) {
+                SDL_DestroySurface(surface);
+            }
+        }
+    };
+    std::unordered_map<std::string, std::unique_ptr<SDL_Surface, SDLSurfaceDeleter>> decoded_surfaces_;    ///< @brief 已解码、等待上传的图片
+    std::unordered_set<std::string> loaded_paths_;      ///< @brief 已上传为纹理的路径 (textures_ 的键的副本，供工作线程查询)
+    std::mutex decode_mutex_;                           ///< @brief 保护 decoded_surfaces_ 和 loaded_paths_
+
 public:
     /**
      * @brief 构造函数，执行初始化。
@@ -49,11 +64,15 @@ public:
 
 private: // 仅供 ResourceManager 访问的方法
 
-    SDL_Texture* loadTexture(std::string_view file_path);      ///< @brief 从文件路径加载纹理
+    SDL_Texture* loadTexture(std::string_view file_path);      ///< @brief 从文件路径加载纹理 (已解码的图片直接上传)
+    bool decodeTexture(std::string_view file_path);            ///< @brief 把图片解码到内存等待上传 (线程安全，已加载或已解码时直接返回)
+    std::size_t uploadDecodedTextures();                       ///< @brief 把所有已解码的图片上传为纹理，返回上传的数量
     SDL_Texture* getTexture(std::string_view file_path);       ///< @brief 尝试获取已加载纹理的指针，如果未加载则尝试加载
     glm::vec2 getTextureSize(std::string_view file_path);      ///< @brief 获取指定纹理的尺寸
     void unloadTexture(std::string_view file_path);            ///< @brief 卸载指定的纹理资源
     void clearTextures();                                        ///< @brief 清空所有纹理资源
+    /// @brief 把纹理加入缓存 (设置缩放模式并登记路径)
+    SDL_Texture* addTexture(std::string_view file_path, SDL_Texture* raw_texture);
 };
 
 } // namespace engine::resource
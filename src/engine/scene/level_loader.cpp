@@ -14,16 +14,33 @@
 #include "../resource/resource_manager.h"
 #include "../render/sprite.h"
 #include "../render/animation.h"
+#include "../physics/collision_layer.h"
 #include "../utils/math.h"
 #include <nlohmann/json.hpp>
 #include <fstream>
 #include <spdlog/spdlog.h>
 #include <glm/vec2.hpp>
 #include <filesystem>
+#include <unordered_set>
 
 namespace engine::scene {
 
+LevelLoader::LevelLoader() = default;
+
+LevelLoader::~LevelLoader() = default;
+
 bool LevelLoader::loadLevel(std::string_view level_path, Scene& scene) {
+    return prepareLevel(level_path) && buildLevel(scene);
+}
+
+bool LevelLoader::prepareLevel(std::string_view level_path, engine::resource::ResourceManager* resource_manager,
+                               const std::function<void(float)>& report_progress) {
+    auto report = [&report_progress](float progress) {
+        if (report_progress) report_progress(progress);
+    };
+    prepared_ = false;
+    report(0.0f);
+
     // 1. 加载 JSON 文件
     auto path = std::filesystem::path(level_path);
     std::ifstream file(path);
@@ -41,10 +58,15 @@ bool LevelLoader::loadLevel(std::string_view level_path, Scene& scene) {
         return false;
     }
 
+    // 不同地图的 gid 对应不同的瓦片，预制体不能沿用
+    prefab_cache_.clear();
+    prepared_tiles_.clear();
+
     // 3. 获取基本地图信息 (名称、地图尺寸、瓦片尺寸)
     map_path_ = level_path;
     map_size_ = glm::ivec2(json_data.value("width", 0), json_data.value("height", 0));
     tile_size_ = glm::ivec2(json_data.value("tilewidth", 0), json_data.value("tileheight", 0));
+    report(0.1f);
 
     // 4. 加载 tileset 数据
     if (json_data.contains("tilesets") && json_data["tilesets"].is_array()) {
@@ -59,13 +81,52 @@ bool LevelLoader::loadLevel(std::string_view level_path, Scene& scene) {
             loadTileset(tileset_path, first_gid);
         }
     }
+    report(0.2f);
 
-    // 5. 加载图层数据
+    // 5. 准备图层数据：瓦片图层生成瓦片数组，对象图层生成预制体
     if (!json_data.contains("layers") || !json_data["layers"].is_array()) {       // 地图文件中必须有 layers 数组
         spdlog::error("地图文件 '{}' 中缺少或无效的 'layers' 数组。", level_path);
         return false;
     }
-    for (const auto& layer_json : json_data["layers"]) {
+    const auto& layers = json_data["layers"];
+    prepared_tiles_.resize(layers.size());
+    for (std::size_t i = 0; i < layers.size(); ++i) {
+        const auto& layer_json = layers[i];
+        if (layer_json.value("visible", true)) {
+            std::string layer_type = layer_json.value("type", "none");
+            if (layer_type == "tilelayer") {
+                prepared_tiles_[i] = prepareTileLayer(layer_json);
+            } else if (layer_type == "objectgroup") {
+                prepareObjectLayer(layer_json);
+            }
+        }
+        report(0.2f + 0.3f * static_cast<float>(i + 1) / static_cast<float>(layers.size()));
+    }
+    map_json_ = std::move(json_data);
+
+    // 6. 解码关卡用到的图片 (上传为纹理需要渲染器，留给主线程)
+    if (resource_manager) {
+        auto texture_paths = collectTexturePaths();
+        for (std::size_t i = 0; i < texture_paths.size(); ++i) {
+            resource_manager->decodeTexture(texture_paths[i]);
+            report(0.5f + 0.5f * static_cast<float>(i + 1) / static_cast<float>(texture_paths.size()));
+        }
+    }
+
+    prepared_ = true;
+    report(1.0f);
+    spdlog::info("关卡准备完成: {}", level_path);
+    return true;
+}
+
+bool LevelLoader::buildLevel(Scene& scene) {
+    if (!prepared_) {
+        spdlog::error("关卡 '{}' 尚未准备好，无法创建对象。", map_path_);
+        return false;
+    }
+    const auto& layers = map_json_["layers"];
+    for (std::size_t i = 0; i < layers.size(); ++i) {
+        const auto& layer_json = layers[i];
         // 获取各图层对象中的类型（type）字段
         std::string layer_type = layer_json.value("type", "none");
         if (!layer_json.value("visible", true)) {
@@ -77,7 +138,7 @@ bool LevelLoader::loadLevel(std::string_view level_path, Scene& scene) {
         if (layer_type == "imagelayer") {       
             loadImageLayer(layer_json, scene);
         } else if (layer_type == "tilelayer") {
-            loadTileLayer(layer_json, scene);
+            loadTileLayer(layer_json, prepared_tiles_[i], scene);
         } else if (layer_type == "objectgroup") {
             loadObjectLayer(layer_json, scene);
         } else {
@@ -85,7 +146,7 @@ bool LevelLoader::loadLevel(std::string_view level_path, Scene& scene) {
         }
     }
 
-    spdlog::info("关卡加载完成: {}", level_path);
+    spdlog::info("关卡加载完成: {}", map_path_);
     return true;
 }
 
@@ -121,14 +182,14 @@ void LevelLoader::loadImageLayer(const nlohmann::json& layer_json, Scene& scene)
     spdlog::info("加载图层: '{}' 完成", layer_name);
 }
 
-void LevelLoader::loadTileLayer(const nlohmann::json& layer_json, Scene& scene)
+std::vector<engine::component::TileInfo> LevelLoader::prepareTileLayer(const nlohmann::json& layer_json)
 {
+    std::vector<engine::component::TileInfo> tiles;
     if (!layer_json.contains("data") || !layer_json["data"].is_array()) {
         spdlog::error("图层 '{}' 缺少 'data' 属性。", layer_json.value("name", "Unnamed"));
-        return;
+        return tiles;
     }
     // 准备 TileInfo Vector (瓦片数量 = 地图宽度 * 地图高度)
-    std::vector<engine::component::TileInfo> tiles;
     tiles.reserve(map_size_.x * map_size_.y);
 
     // 获取图层数据 (瓦片 ID 列表)
@@ -138,18 +199,62 @@ void LevelLoader::loadTileLayer(const nlohmann::json& layer_json, Scene& scene)
     for (const auto& gid : data) {
         tiles.push_back(getTileInfoByGid(gid));
     }
+    return tiles;
+}
+
+void LevelLoader::loadTileLayer(const nlohmann::json& layer_json, const std::vector<engine::component::TileInfo>& tiles, Scene& scene)
+{
+    if (!layer_json.contains("data") || !layer_json["data"].is_array()) {
+        return;     // 准备阶段已经报告过错误
+    }
 
     // 获取图层名称
     std::string layer_name = layer_json.value("name", "Unnamed");
     // 创建游戏对象
     auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
     // 添加Tilelayer组件
-    game_object->addComponent<engine::component::TileLayerComponent>(tile_size_, map_size_, std::move(tiles));
+    game_object->addComponent<engine::component::TileLayerComponent>(tile_size_, map_size_, std::vector<engine::component::TileInfo>(tiles));
     // 添加到场景中
     scene.addGameObject(std::move(game_object));
     spdlog::info("加载瓦片图层: '{}' 完成", layer_name);
 }
 
+void LevelLoader::prepareObjectLayer(const nlohmann::json& layer_json)
+{
+    if (!layer_json.contains("objects") || !layer_json["objects"].is_array()) return;
+    for (const auto& object : layer_json["objects"]) {
+        auto gid = object.value("gid", 0);
+        if (gid != 0) getObjectPrefab(gid);     // 同一 gid 只生成一次
+    }
+}
+
+std::vector<std::string> LevelLoader::collectTexturePaths()
+{
+    std::vector<std::string> paths;
+    std::unordered_set<std::string_view> seen;
+    auto add = [&paths, &seen](std::string_view path) {
+        if (path.empty() || seen.contains(path)) return;
+        seen.insert(path);
+        paths.emplace_back(path);
+    };
+    // 图片图层
+    std::vector<std::string> image_layer_paths;
+    for (const auto& layer_json : map_json_["layers"]) {
+        if (layer_json.value("type", "none") != "imagelayer" || !layer_json.value("visible", true)) continue;
+        std::string image_path = layer_json.value("image", "");
+        if (!image_path.empty()) image_layer_paths.push_back(resolvePath(image_path, map_path_));
+    }
+    for (const auto& path : image_layer_paths) add(path);
+    // 瓦片图层与对象预制体
+    for (const auto& tiles : prepared_tiles_) {
+        for (const auto& tile : tiles) add(tile.sprite.getTextureId());
+    }
+    for (const auto& [gid, prefab] : prefab_cache_) {
+        if (prefab.valid) add(prefab.sprite.getTextureId());
+    }
+    return paths;
+}
+
 void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene)
 {
     if (!layer_json.contains("objects") || !layer_json["objects"].is_array()) {
@@ -192,133 +297,63 @@ void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene
                     // 添加物理组件，不受重力影响
                 game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
                 
-                // 获取标签信息并设置
+                // 获取标签信息并设置，同时根据标签设置碰撞类别 (没有标签的触发器归为 TRIGGER 类别)
                 if (auto tag = getTileProperty<std::string>(object, "tag"); tag) {  // 如果有标签
                     game_object->setTag(tag.value());
+                    cc->setCollisionLayer(engine::physics::layerFromTag(tag.value()));
+                } else if (cc->isTrigger()) {
+                    cc->setCollisionLayer(engine::physics::CollisionLayer::TRIGGER);
                 }
                 // 添加到场景
                 scene.addGameObject(std::move(game_object));
                 spdlog::info("加载对象: '{}' 完成 (类型: 自定义形状)", object_name);
             }
-        } else {        // 如果gid存在，则按照图片解析流程
-            // --- 根据gid获取必要信息，每个gid对应一个游戏对象 ---
-            auto tile_info = getTileInfoByGid(gid);
-            if (tile_info.sprite.getTextureId().empty()) {
-                spdlog::error("gid为 {} 的瓦片没有图像纹理。", gid);
-                continue;
-            }
+        } else {        // 如果gid存在，则按照预制体创建 (同一 gid 的瓦片数据只解析一次)
+            const auto& prefab = getObjectPrefab(gid);
+            if (!prefab.valid) continue;    // 错误已在生成预制体时报告
+
             // 获取Transform相关信息
             auto position = glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f));
             auto dst_size = glm::vec2(object.value("width", 0.0f), object.value("height", 0.0f));
             position = glm::vec2(position.x, position.y - dst_size.y);  // 实际position需要进行调整(左下角到左上角)
-
             auto rotation = object.value("rotation", 0.0f);
-            auto src_size_opt = tile_info.sprite.getSourceRect();
-            if (!src_size_opt) {        // 正常情况下，所有瓦片的Sprite都设置了源矩形，没有代表某处出错
-                spdlog::error("gid为 {} 的瓦片没有源矩形。", gid);
-                continue;
-            }
-            auto src_size = glm::vec2(src_size_opt->w, src_size_opt->h);    // 成员变量除了 value().w 外，也可以这样获取
-            auto scale = dst_size / src_size;
+            auto scale = dst_size / prefab.src_size;
 
             // 获取对象名称
             std::string object_name = object.value("name", "Unnamed");
 
-            // 创建游戏对象并添加组件
+            // 创建游戏对象并按预制体添加组件 (添加顺序与逐个解析时相同)
             auto game_object = std::make_unique<engine::object::GameObject>(object_name);
             game_object->addComponent<engine::component::TransformComponent>(position, scale, rotation);
-            game_object->addComponent<engine::component::SpriteComponent>(std::move(tile_info.sprite), scene.getContext().getResourceManager());
-
-            // 获取瓦片json信息      1. 必然存在，因为getTileInfoByGid(gid)函数已经顺利执行
-                                // 2. 这里再获取json，实际上检索了两次，未来可以优化
-            auto tile_json_opt = getTileJsonByGid(gid);
-            if (!tile_json_opt) {
-                spdlog::error("gid为 {} 的瓦片没有对应的 JSON 数据。", gid);
-                continue;
-            }
-            auto& tile_json = tile_json_opt.value();
-
-            // 获取碰信息：如果是SOLID类型，则添加物理组件，且图片源矩形区域就是碰撞盒大小
-            if (tile_info.type == engine::component::TileType::SOLID) {
-                auto collider = std::make_unique<engine::physics::AABBCollider>(src_size);
-                game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                // 物理组件不受重力影响
-                game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
-                // 设置标签方便物理引擎检索
-                game_object->setTag("solid");
-            }
-            // 如果非SOLID类型，检查自定义碰撞盒是否存在
-            else if (auto rect = getColliderRect(tile_json); rect) {  
-                // 如果有，添加碰撞组件
-                auto collider = std::make_unique<engine::physics::AABBCollider>(rect->size);
+            auto sprite = prefab.sprite;    // 每个实例持有自己的精灵 (翻转等状态会被修改)
+            game_object->addComponent<engine::component::SpriteComponent>(std::move(sprite), scene.getContext().getResourceManager());
+            if (prefab.collider) {
+                auto collider = std::make_unique<engine::physics::AABBCollider>(prefab.collider->size);
                 auto* cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                cc->setOffset(rect->position);  // 自定义碰撞盒的坐标是相对于图片坐标，也就是针对Transform的偏移量
-                // 和物理组件（默认不受重力影响）
-                game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
+                cc->setOffset(prefab.collider->position);   // 碰撞盒的坐标是相对于图片坐标，也就是针对Transform的偏移量
+                cc->setCollisionLayer(prefab.collision_layer);
             }
-
-            // 获取标签信息并设置
-            auto tag = getTileProperty<std::string>(tile_json, "tag");
-            if (tag) {
-                game_object->setTag(tag.value());
-            }
-            // 如果是危险瓦片，且没有手动设置标签，则自动设置标签为 "hazard"
-            else if (tile_info.type == engine::component::TileType::HAZARD) {
-                game_object->setTag("hazard");
+            if (prefab.has_physics) {
+                game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), prefab.use_gravity);
             }
-
-            // 获取重力信息并设置
-            auto gravity = getTileProperty<bool>(tile_json, "gravity");
-            if (gravity) {
-                auto pc = game_object->getComponent<engine::component::PhysicsComponent>();
-                if (pc) {
-                    pc->setUseGravity(gravity.value());
-                } else {
-                    spdlog::warn("对象 '{}' 在设置重力信息时没有物理组件，请检查地图设置。", object_name);
-                    game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), gravity.value());
-                }
+            if (!prefab.tag.empty()) {
+                game_object->setTag(prefab.tag);
             }
-
-            // 获取动画信息并设置
-            auto anim_string = getTileProperty<std::string>(tile_json, "animation");
-            if (anim_string) {
-                // 解析string为JSON对象
-                nlohmann::json anim_json;
-                try {
-                    anim_json = nlohmann::json::parse(anim_string.value());
-                } catch (const nlohmann::json::parse_error& e) {
-                    spdlog::error("解析动画 JSON 字符串失败: {}", e.what());
-                    continue;  // 跳过此对象
-                }
-                // 添加AnimationComponent
+            if (prefab.has_animation) {
                 auto* ac = game_object->addComponent<engine::component::AnimationComponent>();
-                // 添加动画到 AnimationComponent
-                addAnimation(anim_json, ac, src_size);
-            }
-
-            // 获取音效信息并设置
-            auto sound_string = getTileProperty<std::string>(tile_json, "sound");
-            if (sound_string) {
-                // 解析string为JSON对象
-                nlohmann::json sound_json;
-                try {
-                    sound_json = nlohmann::json::parse(sound_string.value());
-                } catch (const nlohmann::json::parse_error& e) {
-                    spdlog::error("解析音效 JSON 字符串失败: {}", e.what());
-                    continue;  // 跳过此对象
+                for (const auto& animation : prefab.animations) {
+                    ac->addAnimation(animation);    // 动画数据只读，所有实例共享同一份
                 }
-                // 添加AudioComponent
+            }
+            if (prefab.has_sound) {
                 auto* audio_component = game_object->addComponent<engine::component::AudioComponent>(&scene.getContext().getAudioPlayer(),
                                                                                                      &scene.getContext().getCamera());
-                // 添加音效到 AudioComponent
-                addSound(sound_json, audio_component);
+                for (const auto& [sound_id, sound_path] : prefab.sounds) {
+                    audio_component->addSound(sound_id, sound_path);
+                }
             }
-
-            // 获取生命值信息并设置
-            auto health = getTileProperty<int>(tile_json, "health");
-            if (health) {
-                // 添加 HealthComponent
-                game_object->addComponent<engine::component::HealthComponent>(health.value());
+            if (prefab.health) {
+                game_object->addComponent<engine::component::HealthComponent>(prefab.health.value());
             }
 
             // 添加到场景中
@@ -328,11 +363,110 @@ void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene
     }
 }
 
-void LevelLoader::addAnimation(const nlohmann::json& anim_json, engine::component::AnimationComponent *ac, const glm::vec2& sprite_size)
+const LevelLoader::ObjectPrefab& LevelLoader::getObjectPrefab(int gid)
+{
+    auto [it, inserted] = prefab_cache_.try_emplace(gid);
+    if (inserted) {
+        buildObjectPrefab(gid, it->second);
+    }
+    return it->second;
+}
+
+void LevelLoader::buildObjectPrefab(int gid, ObjectPrefab& prefab)
+{
+    // --- 根据gid获取必要信息 ---
+    auto tile_info = getTileInfoByGid(gid);
+    if (tile_info.sprite.getTextureId().empty()) {
+        spdlog::error("gid为 {} 的瓦片没有图像纹理。", gid);
+        return;
+    }
+    auto src_size_opt = tile_info.sprite.getSourceRect();
+    if (!src_size_opt) {        // 正常情况下，所有瓦片的Sprite都设置了源矩形，没有代表某处出错
+        spdlog::error("gid为 {} 的瓦片没有源矩形。", gid);
+        return;
+    }
+    prefab.src_size = glm::vec2(src_size_opt->w, src_size_opt->h);
+    prefab.sprite = std::move(tile_info.sprite);
+
+    // 获取瓦片json信息 (必然存在，因为getTileInfoByGid(gid)函数已经顺利执行)
+    auto tile_json_opt = getTileJsonByGid(gid);
+    if (!tile_json_opt) {
+        spdlog::error("gid为 {} 的瓦片没有对应的 JSON 数据。", gid);
+        return;
+    }
+    const auto& tile_json = tile_json_opt.value();
+
+    // 获取碰信息：如果是SOLID类型，则添加物理组件，且图片源矩形区域就是碰撞盒大小
+    if (tile_info.type == engine::component::TileType::SOLID) {
+        prefab.collider = engine::utils::Rect{glm::vec2(0.0f), prefab.src_size};
+        prefab.has_physics = true;      // 物理组件不受重力影响
+        prefab.tag = "solid";           // 设置标签方便物理引擎检索
+    }
+    // 如果非SOLID类型，检查自定义碰撞盒是否存在，有则添加碰撞组件和物理组件（默认不受重力影响）
+    else if (auto rect = getColliderRect(tile_json); rect) {
+        prefab.collider = rect;
+        prefab.has_physics = true;
+    }
+
+    // 获取标签信息
+    if (auto tag = getTileProperty<std::string>(tile_json, "tag"); tag) {
+        prefab.tag = tag.value();
+    }
+    // 如果是危险瓦片，且没有手动设置标签，则自动设置标签为 "hazard"
+    else if (tile_info.type == engine::component::TileType::HAZARD) {
+        prefab.tag = "hazard";
+    }
+    // 根据最终标签设置碰撞类别和掩码，供物理引擎快速筛选
+    prefab.collision_layer = engine::physics::layerFromTag(prefab.tag);
+
+    // 获取重力信息
+    if (auto gravity = getTileProperty<bool>(tile_json, "gravity"); gravity) {
+        if (!prefab.has_physics) {
+            spdlog::warn("gid为 {} 的瓦片在设置重力信息时没有物理组件，请检查地图设置。", gid);
+            prefab.has_physics = true;
+        }
+        prefab.use_gravity = gravity.value();
+    }
+
+    // 获取动画信息并解析
+    if (auto anim_string = getTileProperty<std::string>(tile_json, "animation"); anim_string) {
+        nlohmann::json anim_json;
+        try {
+            anim_json = nlohmann::json::parse(anim_string.value());
+        } catch (const nlohmann::json::parse_error& e) {
+            spdlog::error("解析动画 JSON 字符串失败: {}", e.what());
+            return;     // 跳过此 gid 的所有对象
+        }
+        prefab.has_animation = true;
+        parseAnimations(anim_json, prefab.src_size, prefab.animations);
+    }
+
+    // 获取音效信息并解析
+    if (auto sound_string = getTileProperty<std::string>(tile_json, "sound"); sound_string) {
+        nlohmann::json sound_json;
+        try {
+            sound_json = nlohmann::json::parse(sound_string.value());
+        } catch (const nlohmann::json::parse_error& e) {
+            spdlog::error("解析音效 JSON 字符串失败: {}", e.what());
+            return;     // 跳过此 gid 的所有对象
+        }
+        prefab.has_sound = true;
+        parseSounds(sound_json, prefab.sounds);
+    }
+
+    // 获取生命值信息
+    prefab.health = getTileProperty<int>(tile_json, "health");
+
+    prefab.valid = true;
+    spdlog::debug("生成 gid 为 {} 的对象预制体", gid);
+}
+
+void LevelLoader::parseAnimations(const nlohmann::json& anim_json, const glm::vec2& sprite_size,
+                                  std::vector<std::shared_ptr<engine::render::Animation>>& animations)
 {
-    // 检查 anim_json 必须是一个对象，并且 ac 不能为 nullptr
-    if (!anim_json.is_object() || !ac) {
-        spdlog::error("无效的动画 JSON 或 AnimationComponent 指针。");
+    // 检查 anim_json 必须是一个对象
+    if (!anim_json.is_object()) {
+        spdlog::error("无效的动画 JSON。");
         return;
     }
     // 遍历动画 JSON 对象中的每个键值对（动画名称 : 动画信息）
@@ -353,7 +487,7 @@ void LevelLoader::addAnimation(const nlohmann::json& anim_json, engine::componen
             continue;
         }
         // 创建一个Animation对象 (默认为循环播放)
-        auto animation = std::make_unique<engine::render::Animation>(anim_name);
+        auto animation = std::make_shared<engine::render::Animation>(anim_name);
 
         // 遍历数组并进行添加帧信息到animation对象
         for (const auto& frame : anim_info["frames"]) {
@@ -372,15 +506,15 @@ void LevelLoader::addAnimation(const nlohmann::json& anim_json, engine::componen
             // 添加动画帧到 Animation
             animation->addFrame(src_rect, duration);
         }
-        // 将 Animation 对象添加到 AnimationComponent 中
-        ac->addAnimation(std::move(animation));
+        // 将 Animation 对象添加到列表中
+        animations.push_back(std::move(animation));
     }
 }
 
-void LevelLoader::addSound(const nlohmann::json &sound_json, engine::component::AudioComponent *audio_component)
+void LevelLoader::parseSounds(const nlohmann::json &sound_json, std::vector<std::pair<std::string, std::string>>& sounds)
 {
-    if (!sound_json.is_object() || !audio_component) {
-        spdlog::error("无效的音效 JSON 或 AudioComponent 指针。");
+    if (!sound_json.is_object()) {
+        spdlog::error("无效的音效 JSON。");
         return;
     }
     // 遍历音效 JSON 对象中的每个键值对（音效id : 音效路径）
@@ -391,8 +525,8 @@ void LevelLoader::addSound(const nlohmann::json &sound_json, engine::component::
             spdlog::warn("音效 '{}' 缺少必要信息。", sound_id);
             continue;
         }
-        // 添加音效到 AudioComponent
-        audio_component->addSound(sound_id, sound_path);
+        // 添加音效到列表
+        sounds.emplace_back(sound_id, sound_path);
     }
 }
 
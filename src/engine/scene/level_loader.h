@@ -1,11 +1,18 @@
 #pragma once
 #include <string>
+#include <cstdint>
 #include <string_view>
 #include <glm/vec2.hpp>
 #include <nlohmann/json.hpp>
 #include <map>
+#include <functional>
+#include <memory>
 #include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include "../utils/math.h"
+#include "../render/sprite.h"
 
 namespace engine::component {
 class AnimationComponent;
@@ -14,20 +21,65 @@ struct TileInfo;
 enum class TileType;
 }
 
+namespace engine::render {
+class Animation;
+}
+
+namespace engine::resource {
+class ResourceManager;
+}
+
 namespace engine::scene {
 class Scene;
 
 /**
  * @brief 负责从 Tiled JSON 文件 (.tmj) 加载关卡数据到 Scene 中。
+ *
+ * 加载分为两步：prepareLevel() 读取并解析文件、生成瓦片数组和对象预制体、解码图片，不访问场景和引擎模块，
+ * 可以在工作线程上执行；buildLevel() 在主线程上根据准备好的数据创建游戏对象。loadLevel() 依次执行两步。
+ * 准备好的数据在 buildLevel() 后仍然保留，可以多次创建同一关卡 (重开关卡时无需再读取和解析文件)。
  */
 class LevelLoader final {
     std::string map_path_;      ///< @brief 地图路径（拼接路径时需要）
+    nlohmann::json map_json_;   ///< @brief 准备好的地图数据 (buildLevel 时使用)
+    bool prepared_ = false;     ///< @brief 是否已经准备好 (prepareLevel 成功)
     glm::ivec2 map_size_;       ///< @brief 地图尺寸(瓦片数量)
     glm::ivec2 tile_size_;      ///< @brief 瓦片尺寸(像素)
     std::map<int, nlohmann::json> tileset_data_;    ///< @brief firstgid -> 瓦片集数据
 
+    /**
+     * @brief 对象层中同一 gid 对象的预制体：瓦片 JSON 只解析一次，之后的对象直接按预制体创建。
+     *
+     * 保存创建组件所需的全部数据 (动画对象在所有实例之间共享)，只有位置、尺寸、旋转和名称因对象而异。
+     */
+    struct ObjectPrefab {
+        bool valid = false;                             ///< @brief 是否可以实例化 (数据有误时该 gid 的所有对象都会被跳过)
+        engine::render::Sprite sprite;                  ///< @brief 精灵 (纹理与源矩形)
+        glm::vec2 src_size = {0.0f, 0.0f};              ///< @brief 源矩形尺寸 (用于计算缩放)
+        std::optional<engine::utils::Rect> collider;    ///< @brief 碰撞盒 (相对于 Transform 的偏移和尺寸)，为空表示没有碰撞组件
+        bool has_physics = false;                       ///< @brief 是否添加物理组件
+        bool use_gravity = false;                       ///< @brief 物理组件是否受重力影响
+        std::string tag;                                ///< @brief 标签 (为空表示不设置)
+        std::uint32_t collision_layer = 0;              ///< @brief 碰撞类别 (由标签决定)
+        bool has_animation = false;                     ///< @brief 是否添加动画组件
+        std::vector<std::shared_ptr<engine::render::Animation>> animations; ///< @brief 解析好的动画 (所有实例共享)
+        bool has_sound = false;                         ///< @brief 是否添加音效组件
+        std::vector<std::pair<std::string, std::string>> sounds;    ///< @brief 音效 (id, 路径)
+        std::optional<int> health;                      ///< @brief 生命值，为空表示没有生命组件
+    };
+    std::unordered_map<int, ObjectPrefab> prefab_cache_;    ///< @brief gid -> 对象预制体 (每个关卡加载时重新生成)
+    /// @brief 准备好的瓦片数组，下标与 map_json_ 中的图层下标一致 (非瓦片图层为空)
+    std::vector<std::vector<engine::component::TileInfo>> prepared_tiles_;
+
 public:
-    LevelLoader() = default;
+    LevelLoader();
+    ~LevelLoader();     // 在源文件中定义，TileInfo 在此处只有前置声明
+
+    // 禁止拷贝和移动
+    LevelLoader(const LevelLoader&) = delete;
+    LevelLoader& operator=(const LevelLoader&) = delete;
+    LevelLoader(LevelLoader&&) = delete;
+    LevelLoader& operator=(LevelLoader&&) = delete;
 
     /**
      * @brief 加载关卡数据到指定的 Scene 对象中。
@@ -37,25 +89,67 @@ public:
      */
     [[nodiscard]] bool loadLevel(std::string_view map_path, Scene& scene);
 
+    /**
+     * @brief 准备关卡数据：读取并解析地图和图块集、生成瓦片数组和对象预制体，并解码关卡用到的图片。
+     * @note 不访问场景和引擎模块 (ResourceManager 的解码接口除外)，可以在工作线程上调用。
+     * @param map_path Tiled JSON 地图文件的路径。
+     * @param resource_manager 用于在后台解码图片，为空时不解码 (纹理在创建对象时同步加载)。
+     * @param report_progress 进度回调 (0~1)，在调用线程上调用，可以为空。
+     * @return bool 是否准备成功。
+     */
+    [[nodiscard]] bool prepareLevel(std::string_view map_path, engine::resource::ResourceManager* resource_manager = nullptr,
+                                    const std::function<void(float)>& report_progress = nullptr);
+
+    /**
+     * @brief 根据 prepareLevel() 准备好的数据创建游戏对象并加入场景 (主线程)。
+     * @param scene 要加载数据的目标 Scene 对象。
+     * @return bool 是否加载成功 (没有准备好时返回 false)。
+     */
+    [[nodiscard]] bool buildLevel(Scene& scene);
+
+    bool isPrepared() const { return prepared_; }   ///< @brief 是否已经准备好
+
 private:
     void loadImageLayer(const nlohmann::json& layer_json, Scene& scene);    ///< @brief 加载图片图层
-    void loadTileLayer(const nlohmann::json& layer_json, Scene& scene);     ///< @brief 加载瓦片图层
+    /// @brief 加载瓦片图层 (复制准备好的瓦片数组 tiles)
+    void loadTileLayer(const nlohmann::json& layer_json, const std::vector<engine::component::TileInfo>& tiles, Scene& scene);
     void loadObjectLayer(const nlohmann::json& layer_json, Scene& scene);   ///< @brief 加载对象图层
+    /// @brief 根据图层数据生成瓦片数组 (准备阶段)
+    std::vector<engine::component::TileInfo> prepareTileLayer(const nlohmann::json& layer_json);
+    /// @brief 生成对象图层中所有 gid 的预制体 (准备阶段)
+    void prepareObjectLayer(const nlohmann::json& layer_json);
+    /// @brief 收集关卡用到的所有图片路径 (去重)
+    std::vector<std::string> collectTexturePaths();
+
+    /**
+     * @brief 获取 gid 对应的对象预制体，第一次获取时解析瓦片数据并缓存。
+     * @param gid 全局 ID。
+     * @return 预制体引用 (解析失败时 valid 为 false)。
+     */
+    const ObjectPrefab& getObjectPrefab(int gid);
+
+    /**
+     * @brief 解析瓦片数据生成对象预制体。
+     * @param gid 全局 ID。
+     * @param prefab 输出的预制体 (成功时 valid 为 true)。
+     */
+    void buildObjectPrefab(int gid, ObjectPrefab& prefab);
 
     /**
-     * @brief 添加动画到指定的 AnimationComponent。
+     * @brief 解析动画数据。
      * @param anim_json 动画json数据（自定义）
-     * @param ac AnimationComponent 指针（动画添加到此组件）
      * @param sprite_size 每一帧动画的尺寸
+     * @param animations 解析出的动画追加到此列表
      */
-    void addAnimation(const nlohmann::json& anim_json, engine::component::AnimationComponent* ac, const glm::vec2& sprite_size);
+    void parseAnimations(const nlohmann::json& anim_json, const glm::vec2& sprite_size,
+                         std::vector<std::shared_ptr<engine::render::Animation>>& animations);
 
     /**
-     * @brief 添加音效到指定的 AudioComponent。
+     * @brief 解析音效数据。
      * @param sound_json 音效json数据（自定义）
-     * @param audio_component AudioComponent 指针（音效添加到此组件）
+     * @param sounds 解析出的 (音效id, 路径) 追加到此列表
      */
-    void addSound(const nlohmann::json& sound_json, engine::component::AudioComponent* audio_component);
+    void parseSounds(const nlohmann::json& sound_json, std::vector<std::pair<std::string, std::string>>& sounds);
 
     /**
      * @brief 获取瓦片属性
@@ -3,14 +3,29 @@
 #include "../object/game_object.h"
 #include "../core/context.h"
 #include "../core/game_state.h"
+#include "../core/thread_pool.h"
 #include "../physics/physics_engine.h"
 #include "../render/camera.h"
+#include "../component/transform_component.h"
+#include "../component/physics_component.h"
+#include "../component/animation_component.h"
 #include "../ui/ui_manager.h"
-#include <algorithm> // for std::remove_if
+#include <algorithm>
+#include <atomic>
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
 
+namespace {
+/// @brief 全局递增的句柄代数，保证不同场景、不同时刻分配的句柄互不相同
+std::atomic<std::uint32_t> next_handle_generation{1};
+/// @brief 并行阶段每个分块的最少对象数 (对象较少时直接在主线程执行，避免调度开销)
+constexpr std::size_t PARALLEL_UPDATE_BATCH = 32;
+/// @brief 空位至少达到这个数量、且超过对象总数的 1/COMPACT_FRACTION 时才压缩 game_objects_
+constexpr std::size_t COMPACT_MIN_TOMBSTONES = 16;
+constexpr std::size_t COMPACT_FRACTION = 4;
+} // namespace
+
 Scene::Scene(std::string_view name, engine::core::Context& context, engine::scene::SceneManager& scene_manager)
     : scene_name_(name),
       context_(context), 
@@ -31,39 +46,41 @@ void Scene::update(float delta_time) {
     if (!is_initialized_) return;
 
     // 先移除上一帧已经标记删除的对象，避免物理更新产生的碰撞事件持有悬空指针
-    bool need_remove = false;  // 设定一个标志，用于判断是否需要移除对象
     for (auto& obj : game_objects_) {
-        if (!obj) {
-            need_remove = true;
-            spdlog::warn("场景 '{}' 中存在空的游戏对象指针，将在本帧清理。", scene_name_);
-            continue;
-        }
-        if (obj->isNeedRemove()) {
-            need_remove = true;
+        if (obj && obj->isNeedRemove()) {
+            // NOTE: 需要先 clean 再销毁，确保组件(如 PhysicsComponent)能正确反注册
             obj->clean();
+            detachGameObject(*obj);     // 旧句柄立即失效
+            obj.reset();
+            ++tombstone_count_;
         }
     }
-    if (need_remove) {
-        // NOTE: 需要先 clean 再 erase，确保组件(如 PhysicsComponent)能正确反注册
-        std::erase_if(game_objects_, [](const std::unique_ptr<engine::object::GameObject>& obj) {
-            return !obj || obj->isNeedRemove();
-        });
-    }
+    // 空位积累到一定比例才压缩 (保持渲染顺序)，频繁增删对象时不必每帧整体移动 game_objects_
+    compactGameObjects();
+
+    // 根据上一帧结束时的相机位置，冻结/唤醒对象
+    updateActivity(delta_time);
+
+    using engine::component::UpdatePhase;
+    // 物理之前的阶段：输入逻辑、AI (并行)、设置速度/施加力
+    runUpdatePhase(UpdatePhase::INPUT, delta_time);
+    runUpdatePhase(UpdatePhase::AI, delta_time);
+    runUpdatePhase(UpdatePhase::PRE_PHYSICS, delta_time);
 
     // 只有游戏进行中，才需要更新物理引擎和相机
     if (context_.getGameState().isPlaying()){
         context_.getPhysicsEngine().update(delta_time);
-        context_.getCamera().update(delta_time);
+        // 相机通过句柄跟随目标，目标已被移除时句柄失效，相机停止跟随
+        auto& camera = context_.getCamera();
+        auto* target = getGameObject(camera.getTarget());
+        camera.update(delta_time, target ? target->getComponent<engine::component::TransformComponent>() : nullptr);
     }
 
-    // 更新所有游戏对象，先略过需要移除的对象
-    for (auto& obj : game_objects_) {
-        if (obj && !obj->isNeedRemove()) {
-            obj->update(delta_time, context_);
-        } else if (!obj) {
-            spdlog::warn("尝试更新一个空的游戏对象指针。");
-        }
-    }
+    // 物理之后的阶段：读取碰撞结果、推进动画 (并行)、收尾逻辑
+    runUpdatePhase(UpdatePhase::POST_PHYSICS, delta_time);
+    runAnimationSystem(delta_time);
+    runUpdatePhase(UpdatePhase::ANIMATION, delta_time);
+    runUpdatePhase(UpdatePhase::LATE, delta_time);
 
     // 更新UI管理器
     ui_manager_->update(delta_time, context_);
@@ -104,19 +121,33 @@ void Scene::clean() {
         if (obj) obj->clean();
     }
     game_objects_.clear();
+    // 剩余的句柄全部失效 (代数是全局递增的，表可以直接清空)
+    handle_slots_.clear();
+    free_handle_slots_.clear();
+    name_index_.clear();
+    tombstone_count_ = 0;
 
     is_initialized_ = false;        // 清理完成后，设置场景为未初始化
     spdlog::trace("场景 '{}' 清理完成。", scene_name_);
 }
 
 void Scene::addGameObject(std::unique_ptr<engine::object::GameObject>&& game_object) {
-    if (game_object) game_objects_.push_back(std::move(game_object));
+    if (game_object) {
+        acquireHandle(*game_object);
+        handle_slots_[game_object->handle_.index].position = static_cast<std::uint32_t>(game_objects_.size());
+        game_object->scene_ = this;
+        addToNameIndex(*game_object);
+        game_objects_.push_back(std::move(game_object));
+    }
     else spdlog::warn("尝试向场景 '{}' 添加空游戏对象。", scene_name_);
 }
 
 void Scene::safeAddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object)
 {
-    if (game_object) pending_additions_.push_back(std::move(game_object));
+    if (game_object) {
+        acquireHandle(*game_object);    // 立即分配句柄，在真正加入场景前就可以被引用
+        pending_additions_.push_back(std::move(game_object));
+    }
     else spdlog::warn("尝试向场景 '{}' 添加空游戏对象。", scene_name_);
 }
 
@@ -126,20 +157,19 @@ void Scene::removeGameObject(engine::object::GameObject* game_object_ptr) {
         return;
     }
 
-    // erase-remove 移除法不可用，因为智能指针与裸指针无法比较
-    // 需要使用 std::remove_if 和 lambda 表达式自定义比较的方式
-    auto it = std::remove_if(game_objects_.begin(), game_objects_.end(),
-                             [game_object_ptr](const std::unique_ptr<engine::object::GameObject>& p) {
-                                 return p.get() == game_object_ptr;    // 比较裸指针是否相等（自定义比较方式）
-                             });
-
-    if (it != game_objects_.end()) {
-        (*it)->clean();             // 因为传入的是指针，因此只可能有一个元素被移除，不需要遍历it到末尾
-        game_objects_.erase(it, game_objects_.end());   // 删除从it到末尾的元素（最后一个元素）
-        spdlog::trace("从场景 '{}' 中移除游戏对象。", scene_name_);
-    } else {
+    // 通过句柄表直接找到对象在 game_objects_ 中的位置，无需遍历
+    if (getGameObject(game_object_ptr->handle_) != game_object_ptr ||
+        handle_slots_[game_object_ptr->handle_.index].position == NO_POSITION) {
         spdlog::warn("游戏对象指针未找到在场景 '{}' 中。", scene_name_);
+        return;
     }
+    auto& slot = game_objects_[handle_slots_[game_object_ptr->handle_.index].position];
+    slot->clean();
+    detachGameObject(*slot);
+    // 留下空位而不是立即 erase：不移动其它元素，遍历 game_objects_ 的过程中调用也是安全的
+    slot.reset();
+    ++tombstone_count_;
+    spdlog::trace("从场景 '{}' 中移除游戏对象。", scene_name_);
 }
 
 void Scene::safeRemoveGameObject(engine::object::GameObject* game_object_ptr)
@@ -147,15 +177,21 @@ void Scene::safeRemoveGameObject(engine::object::GameObject* game_object_ptr)
     game_object_ptr->setNeedRemove(true);
 }
 
+engine::object::GameObject* Scene::getGameObject(engine::object::ObjectHandle handle) const
+{
+    if (handle.index >= handle_slots_.size()) return nullptr;
+    const auto& slot = handle_slots_[handle.index];
+    return slot.generation == handle.generation ? slot.object : nullptr;
+}
+
 engine::object::GameObject *Scene::findGameObjectByName(std::string_view name) const
 {
-    // 找到第一个符合条件的游戏对象就返回
-    for (const auto& obj : game_objects_) {
-        if (obj && obj->getName() == name) {
-            return obj.get();
-        }
-    }
-    return nullptr;
+    // 从未驻留过的名称不可能属于任何对象
+    auto name_id = engine::utils::StringInterner::global().find(name);
+    if (!name_id) return nullptr;
+    auto it = name_index_.find(*name_id);
+    if (it == name_index_.end() || it->second.empty()) return nullptr;
+    return it->second.front();
 }
 
 void Scene::processPendingAdditions()
@@ -167,4 +203,199 @@ void Scene::processPendingAdditions()
     pending_additions_.clear();
 }
 
-} // namespace engine::scene 
\ No newline at end of file
+void Scene::updateActivity(float delta_time)
+{
+    const auto& camera = context_.getCamera();
+    if (!camera.isActivityCullingEnabled()) {
+        // 关闭剔除时唤醒所有对象
+        if (inactive_object_count_ > 0) {
+            for (auto& obj : game_objects_) {
+                if (obj && !obj->active_) setObjectActive(*obj, true);
+            }
+            inactive_object_count_ = 0;
+        }
+        return;
+    }
+
+    // 逐个对象只做一次点与矩形的比较，代价远小于区域外对象被跳过的更新和物理模拟。
+    // 直接按内存顺序遍历变换组件池 (只处理本场景的对象)，不经过 game_objects_ 再逐个查找组件；
+    // 没有变换组件的对象 (如瓦片层) 没有位置，总是更新，不会被冻结，因此无需处理
+    const auto region = camera.getActivityRegion();
+    const auto region_max = region.position + region.size;
+    const auto interval = static_cast<std::uint64_t>(camera.getInactiveUpdateInterval());
+    const auto target = camera.getTarget();
+    inactive_object_count_ = 0;
+    auto& transforms = engine::component::ComponentPool<engine::component::TransformComponent>::get();
+    transforms.forEachLive(0, transforms.getLiveExtent(), [&](engine::component::TransformComponent& transform) {
+        auto* obj = transform.getOwner();
+        if (!obj || obj->scene_ != this) return;
+        // 相机跟随的目标总是更新
+        bool in_region = obj->always_active_ || obj->handle_ == target;
+        if (!in_region) {
+            const auto& position = transform.getPosition();
+            in_region = position.x >= region.position.x && position.x <= region_max.x &&
+                        position.y >= region.position.y && position.y <= region_max.y;
+        }
+        if (in_region) {
+            if (!obj->active_) setObjectActive(*obj, true);
+            return;
+        }
+
+        if (obj->active_) setObjectActive(*obj, false);
+        ++inactive_object_count_;
+        // 降频更新：上一帧已经补上的时间清零，按句柄下标错开各对象的更新帧，避免集中在同一帧
+        bool was_tick = obj->inactive_tick_;
+        if (was_tick) obj->inactive_time_ = 0.0f;
+        obj->inactive_time_ += delta_time;
+        obj->inactive_tick_ = interval > 0 && (activity_frame_ + obj->handle_.index) % interval == 0;
+        // 更新帧中物理也要跟上逻辑：只在这一帧解冻，本帧的时间由正常的物理更新模拟，之前冻结的时间额外补上
+        if (obj->inactive_tick_ || was_tick) {
+            if (auto* physics = obj->getComponent<engine::component::PhysicsComponent>()) {
+                physics->setFrozen(!obj->inactive_tick_);
+                if (obj->inactive_tick_) physics->addCatchUpTime(obj->inactive_time_ - delta_time);
+            }
+        }
+    });
+    ++activity_frame_;
+}
+
+void Scene::setObjectActive(engine::object::GameObject& game_object, bool active)
+{
+    // 唤醒时丢弃区域外累积的时间：对象从冻结时的状态继续，与离开区域多久无关
+    game_object.active_ = active;
+    game_object.inactive_tick_ = false;
+    game_object.inactive_time_ = 0.0f;
+    if (auto* physics = game_object.getComponent<engine::component::PhysicsComponent>()) {
+        physics->setFrozen(!active);
+    }
+}
+
+void Scene::runUpdatePhase(engine::component::UpdatePhase phase, float delta_time)
+{
+    // 略过需要移除的对象 (空位是本帧内被直接移除的对象)，活动区域外的对象只在降频更新的帧执行
+    auto update_range = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            auto* obj = game_objects_[i].get();
+            if (!obj || obj->isNeedRemove() || !obj->hasPhase(phase)) continue;
+            if (obj->active_) {
+                obj->updatePhase(phase, delta_time, context_);
+            } else if (obj->inactive_tick_) {
+                obj->updatePhase(phase, obj->inactive_time_, context_);     // 一次补上累积的时间
+            }
+        }
+    };
+
+    auto& thread_pool = context_.getThreadPool();
+    if (engine::component::isParallelPhase(phase) && thread_pool.getWorkerCount() > 0) {
+        // 并行阶段的组件只访问自身对象，game_objects_ 在阶段内不会增删，可以按下标分块。
+        // 组件可能进行物理空间查询 (只读)，先在主线程上把索引整理好
+        context_.getPhysicsEngine().updateQueryIndex();
+        thread_pool.parallelFor(game_objects_.size(), PARALLEL_UPDATE_BATCH, update_range);
+    } else {
+        update_range(0, game_objects_.size());
+    }
+}
+
+void Scene::runAnimationSystem(float delta_time)
+{
+    // 动画组件不在对象的阶段列表中：按内存顺序直接遍历动画组件池，只更新本场景的对象 (规则与 runUpdatePhase 相同)
+    auto& animations = engine::component::ComponentPool<engine::component::AnimationComponent>::get();
+    auto update_range = [&](std::size_t begin, std::size_t end) {
+        animations.forEachLive(begin, end, [&](engine::component::AnimationComponent& animation) {
+            auto* obj = animation.getOwner();
+            if (!obj || obj->scene_ != this || obj->isNeedRemove()) return;
+            if (obj->active_) {
+                animation.update(delta_time, context_);
+            } else if (obj->inactive_tick_) {
+                animation.update(obj->inactive_time_, context_);
+            }
+        });
+    };
+
+    // 组件池总是复用序号最小的空闲槽位，遍历范围随存活组件数量收缩，与曾经加载过多大的关卡无关
+    auto extent = animations.getLiveExtent();
+    auto& thread_pool = context_.getThreadPool();
+    if (thread_pool.getWorkerCount() > 0) {
+        // 每个动画组件只修改自身和所属对象的精灵，可以按槽位分块并行
+        thread_pool.parallelFor(extent, PARALLEL_UPDATE_BATCH, update_range);
+    } else {
+        update_range(0, extent);
+    }
+}
+
+void Scene::acquireHandle(engine::object::GameObject& game_object)
+{
+    if (getGameObject(game_object.handle_) == &game_object) return;   // 已经在本场景中分配过
+
+    std::uint32_t index;
+    if (!free_handle_slots_.empty()) {
+        index = free_handle_slots_.back();
+        free_handle_slots_.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(handle_slots_.size());
+        handle_slots_.emplace_back();
+    }
+    auto& slot = handle_slots_[index];
+    slot.object = &game_object;
+    slot.position = NO_POSITION;    // 加入 game_objects_ 时再设置
+    do {
+        slot.generation = next_handle_generation.fetch_add(1, std::memory_order_relaxed);
+    } while (slot.generation == 0);     // 回绕时跳过 0 (空闲槽位的代数)
+    game_object.handle_ = {index, slot.generation};
+}
+
+void Scene::releaseHandle(engine::object::GameObject& game_object)
+{
+    if (getGameObject(game_object.handle_) != &game_object) return;   // 不属于本场景
+
+    auto& slot = handle_slots_[game_object.handle_.index];
+    slot.object = nullptr;
+    slot.generation = 0;    // 代数从1开始分配，0 永远不会匹配任何句柄
+    free_handle_slots_.push_back(game_object.handle_.index);
+    game_object.handle_ = {};
+}
+
+void Scene::detachGameObject(engine::object::GameObject& game_object)
+{
+    if (game_object.scene_ == this) {
+        removeFromNameIndex(game_object, game_object.getNameId());
+        game_object.scene_ = nullptr;
+    }
+    releaseHandle(game_object);
+}
+
+void Scene::compactGameObjects()
+{
+    // 遍历 game_objects_ 的地方都会略过空位，少量空位只是多几次空指针判断
+    if (tombstone_count_ < COMPACT_MIN_TOMBSTONES || tombstone_count_ * COMPACT_FRACTION < game_objects_.size()) {
+        return;
+    }
+    std::erase_if(game_objects_, [](const std::unique_ptr<engine::object::GameObject>& obj) { return !obj; });
+    // 压缩后对象的下标发生变化，需要同步到句柄表
+    for (std::size_t i = 0; i < game_objects_.size(); ++i) {
+        handle_slots_[game_objects_[i]->handle_.index].position = static_cast<std::uint32_t>(i);
+    }
+    tombstone_count_ = 0;
+}
+
+void Scene::addToNameIndex(engine::object::GameObject& game_object)
+{
+    name_index_[game_object.getNameId()].push_back(&game_object);
+}
+
+void Scene::removeFromNameIndex(engine::object::GameObject& game_object, engine::utils::StringId name_id)
+{
+    auto it = name_index_.find(name_id);
+    if (it == name_index_.end()) return;
+    // 同名对象通常只有一个，线性删除的代价可以忽略
+    std::erase(it->second, &game_object);
+    if (it->second.empty()) name_index_.erase(it);
+}
+
+void Scene::onGameObjectRenamed(engine::object::GameObject& game_object, engine::utils::StringId old_name_id)
+{
+    removeFromNameIndex(game_object, old_name_id);
+    addToNameIndex(game_object);
+}
+
+} // namespace engine::scene
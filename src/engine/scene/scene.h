@@ -3,6 +3,12 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <cstdint>
+#include <functional>
+#include "../object/object_handle.h"
+#include "../utils/string_interner.h"
+#include "../component/update_phase.h"
+#include <unordered_map>
 
 namespace engine::core {
     class Context;
@@ -26,6 +32,7 @@ namespace engine::scene {
  * 派生类应实现具体的场景逻辑。
  */
 class Scene {
+    friend class engine::object::GameObject;    // 对象改名时需要更新名称索引
 protected:
     std::string scene_name_;                            ///< @brief 场景名称
     engine::core::Context& context_;                    ///< @brief 上下文引用（隐式，构造时传入）
@@ -36,6 +43,21 @@ protected:
     std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;         ///< @brief 场景中的游戏对象
     std::vector<std::unique_ptr<engine::object::GameObject>> pending_additions_;    ///< @brief 待添加的游戏对象（延时添加）
 
+    /// @brief 句柄表的槽位：对象指针为空表示槽位空闲 (墓碑)，旧句柄因代数不同而失效
+    struct HandleSlot {
+        engine::object::GameObject* object = nullptr;
+        std::uint32_t generation = 0;
+        std::uint32_t position = NO_POSITION;   ///< @brief 对象在 game_objects_ 中的下标 (尚在待添加列表中时为 NO_POSITION)
+    };
+    static constexpr std::uint32_t NO_POSITION = 0xFFFFFFFFu;
+    std::vector<HandleSlot> handle_slots_;              ///< @brief 句柄表 (以 ObjectHandle::index 为下标)
+    std::vector<std::uint32_t> free_handle_slots_;      ///< @brief 空闲槽位序号 (后进先出)
+    /// @brief 名称索引：名称ID -> 同名对象 (按加入场景的顺序)，只包含 game_objects_ 中的对象
+    std::unordered_map<engine::utils::StringId, std::vector<engine::object::GameObject*>> name_index_;
+    std::size_t tombstone_count_ = 0;                   ///< @brief game_objects_ 中被移除的对象留下的空位数量
+    std::uint64_t activity_frame_ = 0;                  ///< @brief 活动区域的帧计数 (决定区域外对象在哪一帧降频更新)
+    std::size_t inactive_object_count_ = 0;             ///< @brief 本帧处于活动区域外的对象数量
+
 public:
     /**
      * @brief 构造函数。
@@ -62,22 +84,36 @@ public:
     virtual void handleInput();                 ///< @brief 处理输入。
     virtual void clean();                       ///< @brief 清理场景。
 
+    /**
+     * @brief 在加载线程上准备场景数据 (由 SceneManager::requestReplaceSceneAsync 调用，早于 init)。
+     *
+     * 适合读取文件、解析数据、解码图片等耗时工作。此时场景尚未加入场景栈，
+     * 不能访问物理引擎、渲染器等引擎模块，也不能创建游戏对象，这些工作留给主线程上的 init()。
+     * @param report_progress 进度回调 (0.0 ~ 1.0)，可以为空，在加载线程上调用。
+     * @return 准备失败时返回 false (场景仍会切换，由 init() 自行处理缺失的数据)。
+     */
+    virtual bool prepare(const std::function<void(float)>& /*report_progress*/) { return true; }
+
     /// @brief 直接向场景中添加一个游戏对象。（初始化时可用，游戏进行中不安全） （&&表示右值引用，与std::move搭配使用，避免拷贝）
     virtual void addGameObject(std::unique_ptr<engine::object::GameObject>&& game_object);
 
     /// @brief 安全地添加游戏对象。（添加到pending_additions_中）
     virtual void safeAddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object); 
 
-    /// @brief 直接从场景中移除一个游戏对象。（一般不使用，但保留实现的逻辑）
+    /// @brief 直接从场景中移除一个游戏对象 (O(1)：对象立即销毁，留下的空位在积累到一定比例后统一压缩)
     virtual void removeGameObject(engine::object::GameObject* game_object_ptr);
 
     /// @brief 安全地移除游戏对象。（设置need_remove_标记）
     virtual void safeRemoveGameObject(engine::object::GameObject* game_object_ptr);
 
-    /// @brief 获取场景中的游戏对象容器。
+    /// @brief 获取场景中的游戏对象容器 (可能包含被移除的对象留下的空指针)。
     const std::vector<std::unique_ptr<engine::object::GameObject>>& getGameObjects() const { return game_objects_; }
+    std::size_t getInactiveObjectCount() const { return inactive_object_count_; }   ///< @brief 获取本帧处于活动区域外的对象数量
+
+    /// @brief 解析句柄。对象已被移除 (或句柄来自其它场景、尚未分配) 时返回 nullptr。
+    engine::object::GameObject* getGameObject(engine::object::ObjectHandle handle) const;
 
-    /// @brief 根据名称查找游戏对象（返回找到的第一个对象）。
+    /// @brief 根据名称查找游戏对象（返回最先加入场景的同名对象，哈希索引查找）。
     engine::object::GameObject* findGameObjectByName(std::string_view name) const;
 
     // getters and setters
@@ -91,6 +127,20 @@ public:
 
 protected:
     void processPendingAdditions();     ///< @brief 处理待添加的游戏对象。（每轮更新的最后调用）
+    void updateActivity(float delta_time);  ///< @brief 根据相机的活动区域冻结/唤醒对象，并决定区域外对象本帧是否降频更新
+    void setObjectActive(engine::object::GameObject& game_object, bool active);    ///< @brief 唤醒或冻结对象 (同时冻结其物理)
+    /// @brief 对所有游戏对象执行一个更新阶段 (并行阶段分块交给线程池)
+    void runUpdatePhase(engine::component::UpdatePhase phase, float delta_time);
+    /// @brief 动画系统：遍历动画组件池推进本场景对象的动画 (ANIMATION 阶段，并行)
+    void runAnimationSystem(float delta_time);
+    void acquireHandle(engine::object::GameObject& game_object);   ///< @brief 为加入场景的对象分配句柄 (已有句柄时不重复分配)
+    void releaseHandle(engine::object::GameObject& game_object);   ///< @brief 回收对象的句柄，使其所有旧句柄失效
+    void detachGameObject(engine::object::GameObject& game_object); ///< @brief 对象离开 game_objects_：移出名称索引并回收句柄
+    void compactGameObjects();          ///< @brief 空位较多时移除 game_objects_ 中的空位，并更新剩余对象的下标
+    void addToNameIndex(engine::object::GameObject& game_object);
+    void removeFromNameIndex(engine::object::GameObject& game_object, engine::utils::StringId name_id);
+    /// @brief 对象改名时由 GameObject 调用，更新名称索引
+    void onGameObjectRenamed(engine::object::GameObject& game_object, engine::utils::StringId old_name_id);
 };
 
 } // namespace engine::scene
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "scene_manager.h"
 #include "scene.h"
 #include "../core/context.h"
+#include "../resource/resource_manager.h"
 #include <spdlog/spdlog.h>
+#include <chrono>
 
 namespace engine::scene {
 
@@ -30,6 +32,8 @@ void SceneManager::update(float delta_time) {
     }
     // 执行可能的切换场景操作
     processPendingActions();
+    // 检查后台加载的场景
+    processLoading();
 }
 
 void SceneManager::render() {
@@ -51,6 +55,7 @@ void SceneManager::handleInput() {
 
 void SceneManager::close() {
     spdlog::trace("正在关闭场景管理器并清理场景栈...");
+    waitForLoading();
     // 清理栈中所有剩余的场景（从顶到底）
     while (!scene_stack_.empty()) {
         if (scene_stack_.back()) {
@@ -72,6 +77,31 @@ void SceneManager::requestReplaceScene(std::unique_ptr<Scene>&& scene)
     pending_scene_ = std::move(scene);
 }
 
+void SceneManager::requestReplaceSceneAsync(std::unique_ptr<Scene>&& scene, LoadProgressCallback on_progress)
+{
+    if (!scene) {
+        spdlog::warn("尝试在后台加载空场景。");
+        return;
+    }
+    if (isLoading()) {
+        spdlog::warn("场景 '{}' 正在加载，忽略加载场景 '{}' 的请求。", loading_scene_->getName(), scene->getName());
+        return;
+    }
+    spdlog::debug("开始在后台加载场景 '{}' 。", scene->getName());
+
+    loading_scene_ = std::move(scene);
+    loading_requester_ = getCurrentScene();
+    load_progress_callback_ = std::move(on_progress);
+    load_progress_.store(0.0f, std::memory_order_relaxed);
+    reported_progress_ = -1.0f;
+    // 场景对象由 loading_scene_ 持有，加载期间不会被销毁 (close 会先等待加载线程结束)
+    loading_future_ = std::async(std::launch::async, [this, scene_ptr = loading_scene_.get()]() {
+        return scene_ptr->prepare([this](float progress) {
+            load_progress_.store(progress, std::memory_order_relaxed);
+        });
+    });
+}
+
 void SceneManager::requestPushScene(std::unique_ptr<Scene>&& scene)
 {
     pending_action_ = PendingAction::Push;
@@ -88,9 +118,15 @@ void SceneManager::processPendingActions()
 
     switch (pending_action_) {
         case PendingAction::Pop:
+            // 发起加载的场景被弹出后，加载完成的场景已没有可以替换的对象
+            if (isLoading() && getCurrentScene() == loading_requester_) {
+                cancelLoading();
+            }
             popScene();
             break;
         case PendingAction::Replace:
+            // 显式的替换 (如重新开始、返回标题) 优先于后台加载的场景
+            cancelLoading();
             replaceScene(std::move(pending_scene_));
             break;
         case PendingAction::Push:
@@ -103,6 +139,93 @@ void SceneManager::processPendingActions()
     pending_action_ = PendingAction::None;
 }
 
+void SceneManager::processLoading()
+{
+    reapCancelledLoads();
+    if (!isLoading()) {
+        return;
+    }
+
+    // 进度回调总在主线程上调用
+    float progress = load_progress_.load(std::memory_order_relaxed);
+    if (load_progress_callback_ && progress != reported_progress_) {
+        reported_progress_ = progress;
+        load_progress_callback_(progress);
+    }
+
+    if (loading_future_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return;
+    }
+    // 发起加载的场景上方还有其它场景 (如暂停菜单、结束场景) 时先不切换
+    if (getCurrentScene() != loading_requester_) {
+        return;
+    }
+    bool prepared = false;
+    try {
+        prepared = loading_future_.get();
+    } catch (const std::exception& e) {
+        spdlog::error("场景 '{}' 加载时发生异常: {}", loading_scene_->getName(), e.what());
+    }
+    if (!prepared) {
+        spdlog::warn("场景 '{}' 准备失败，将在初始化时同步加载。", loading_scene_->getName());
+    }
+
+    // 纹理上传需要渲染器，只能在主线程进行
+    auto uploaded = context_.getResourceManager().uploadDecodedTextures();
+    spdlog::debug("场景 '{}' 加载完成，上传了 {} 张纹理。", loading_scene_->getName(), uploaded);
+
+    auto callback = std::move(load_progress_callback_);
+    load_progress_callback_ = nullptr;
+    loading_requester_ = nullptr;
+    replaceScene(std::move(loading_scene_));
+    loading_scene_.reset();
+    if (callback) {
+        callback(1.0f);
+    }
+}
+
+void SceneManager::cancelLoading()
+{
+    if (!isLoading()) {
+        return;
+    }
+    spdlog::debug("取消场景 '{}' 的后台加载。", loading_scene_->getName());
+    cancelled_loads_.push_back({std::move(loading_scene_), std::move(loading_future_)});
+    loading_scene_.reset();
+    loading_requester_ = nullptr;
+    load_progress_callback_ = nullptr;
+}
+
+void SceneManager::reapCancelledLoads()
+{
+    std::erase_if(cancelled_loads_, [](CancelledLoad& load) {
+        if (load.future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+        try {
+            load.future.get();
+        } catch (const std::exception& e) {
+            spdlog::error("已取消的场景 '{}' 加载时发生异常: {}", load.scene->getName(), e.what());
+        }
+        spdlog::trace("已丢弃取消加载的场景 '{}' 。", load.scene->getName());
+        return true;
+    });
+}
+
+void SceneManager::waitForLoading()
+{
+    cancelLoading();
+    for (auto& load : cancelled_loads_) {
+        spdlog::debug("等待场景 '{}' 的加载线程结束...", load.scene->getName());
+        try {
+            load.future.get();
+        } catch (const std::exception& e) {
+            spdlog::error("场景 '{}' 加载时发生异常: {}", load.scene->getName(), e.what());
+        }
+    }
+    cancelled_loads_.clear();
+}
+
 void SceneManager::pushScene(std::unique_ptr<Scene>&& scene) {
     if (!scene) {
         spdlog::warn("尝试将空场景压入栈。");
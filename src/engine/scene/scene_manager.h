@@ -2,6 +2,9 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <atomic>
+#include <functional>
+#include <future>
 
 // 前置声明
 namespace engine::core {
@@ -17,6 +20,9 @@ namespace engine::scene {
  * @brief 管理游戏中的场景栈，处理场景切换和生命周期。
  */
 class SceneManager final {
+public:
+    using LoadProgressCallback = std::function<void(float)>;   ///< @brief 加载进度回调 (0.0 ~ 1.0，在主线程上调用)
+
 private:
     engine::core::Context& context_;                        ///< @brief 引擎上下文引用
     std::vector<std::unique_ptr<Scene>> scene_stack_;       ///< @brief 场景栈
@@ -25,6 +31,21 @@ private:
     PendingAction pending_action_ = PendingAction::None;    ///< @brief 待处理的动作
     std::unique_ptr<Scene> pending_scene_;                  ///< @brief 待处理场景
 
+    // 后台加载 (同一时间只有一个)
+    std::unique_ptr<Scene> loading_scene_;                  ///< @brief 正在加载线程上准备的场景
+    std::future<bool> loading_future_;                      ///< @brief 加载任务 (Scene::prepare 的结果)
+    Scene* loading_requester_ = nullptr;                    ///< @brief 发起加载的场景 (非拥有)，只有它位于栈顶时才切换
+    std::atomic<float> load_progress_ = 0.0f;               ///< @brief 加载线程写入的进度
+    float reported_progress_ = -1.0f;                       ///< @brief 上一次通知回调的进度
+    LoadProgressCallback load_progress_callback_;           ///< @brief 加载进度回调
+
+    /// @brief 被取消的加载：等加载线程结束后再销毁场景 (future 的析构会阻塞)
+    struct CancelledLoad {
+        std::unique_ptr<Scene> scene;
+        std::future<bool> future;
+    };
+    std::vector<CancelledLoad> cancelled_loads_;            ///< @brief 等待加载线程结束的已取消加载
+
 public:
     explicit SceneManager(engine::core::Context& context);
     ~SceneManager();
@@ -39,10 +60,23 @@ public:
     void requestPushScene(std::unique_ptr<Scene>&& scene);      ///< @brief 请求压入一个新场景。
     void requestPopScene();                                     ///< @brief 请求弹出当前场景。
     void requestReplaceScene(std::unique_ptr<Scene>&& scene);   ///< @brief 请求替换当前场景。
+    /**
+     * @brief 请求在后台准备场景，准备完成后替换当前场景。
+     *
+     * 场景的 prepare() 在加载线程上运行，期间当前场景照常更新和渲染；
+     * 完成后在主线程上传已解码的纹理，再像 requestReplaceScene 一样替换场景 (调用 init)。
+     * 只有发起请求的场景 (当时的栈顶) 重新位于栈顶时才会切换，例如暂停菜单弹出后；
+     * 加载期间若有其它替换请求，或发起请求的场景被弹出，加载会被取消。
+     * 已有场景正在加载时忽略此请求。
+     * @param on_progress 加载进度回调，可以为空。
+     */
+    void requestReplaceSceneAsync(std::unique_ptr<Scene>&& scene, LoadProgressCallback on_progress = nullptr);
 
     // getters
     Scene* getCurrentScene() const;                                 ///< @brief 获取当前活动场景（栈顶场景）的指针。
     engine::core::Context& getContext() const { return context_; }  ///< @brief 获取引擎上下文引用。
+    bool isLoading() const { return loading_scene_ != nullptr; }    ///< @brief 是否有场景正在后台加载
+    float getLoadProgress() const { return load_progress_.load(std::memory_order_relaxed); }   ///< @brief 获取后台加载进度 (0.0 ~ 1.0)
 
     // 核心循环函数
     void update(float delta_time);
@@ -52,6 +86,10 @@ public:
 
 private:
     void processPendingActions();                           ///< @brief 处理挂起的场景操作（每轮更新最后调用）。
+    void processLoading();                                  ///< @brief 通知加载进度，加载完成后替换场景。
+    void cancelLoading();                                   ///< @brief 取消正在进行的加载 (不等待加载线程)。
+    void reapCancelledLoads();                              ///< @brief 销毁加载线程已结束的已取消场景。
+    void waitForLoading();                                  ///< @brief 等待所有加载线程结束并丢弃正在加载的场景。
     // 直接切换场景
     void pushScene(std::unique_ptr<Scene>&& scene);         ///< @brief 将一个新场景压入栈顶，使其成为活动场景。
     void popScene();                                        ///< @brief 移除栈顶场景。
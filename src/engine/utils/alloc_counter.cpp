@@ -0,0 +1,68 @@
+#include "alloc_counter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace engine::utils {
+
+#ifdef SUNNYLAND_TRACK_ALLOCATIONS
+
+namespace {
+std::atomic<std::uint64_t> heap_allocations{0};
+std::atomic<std::uint64_t> heap_deallocations{0};
+} // namespace
+
+bool isHeapTrackingEnabled() { return true; }
+std::uint64_t getHeapAllocationCount() { return heap_allocations.load(std::memory_order_relaxed); }
+std::uint64_t getHeapDeallocationCount() { return heap_deallocations.load(std::memory_order_relaxed); }
+
+#else
+
+bool isHeapTrackingEnabled() { return false; }
+std::uint64_t getHeapAllocationCount() { return 0; }
+std::uint64_t getHeapDeallocationCount() { return 0; }
+
+#endif
+
+} // namespace engine::utils
+
+#ifdef SUNNYLAND_TRACK_ALLOCATIONS
+
+// --- 替换全局 operator new/delete (对齐版本沿用标准库实现，不计数) ---
+
+void* operator new(std::size_t size) {
+    engine::utils::heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return ::operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return ::operator new(size, std::nothrow);
+}
+
+void operator delete(void* ptr) noexcept {
+    if (!ptr) return;
+    engine::utils::heap_deallocations.fetch_add(1, std::memory_order_relaxed);
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept { ::operator delete(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { ::operator delete(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { ::operator delete(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { ::operator delete(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { ::operator delete(ptr); }
+
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::utils {
+
+/**
+ * @brief 是否启用了系统堆分配计数。
+ *
+ * 需要在 CMake 中打开 SUNNYLAND_TRACK_ALLOCATIONS 选项，此时全局 operator new/delete 会被替换为计数版本。
+ * 未启用时计数始终为 0。
+ */
+bool isHeapTrackingEnabled();
+
+/// @brief 程序启动以来全局 operator new 的调用次数
+std::uint64_t getHeapAllocationCount();
+
+/// @brief 程序启动以来全局 operator delete 的调用次数 (空指针除外)
+std::uint64_t getHeapDeallocationCount();
+
+} // namespace engine::utils
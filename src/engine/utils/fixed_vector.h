@@ -0,0 +1,73 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace engine::utils {
+
+/**
+ * @brief 容量固定的顺序容器，元素直接存放在对象内部。
+ *
+ * 接口是 std::vector 的一个子集，但从不分配内存，适合上限已知的小列表 (例如每个对象的组件列表)。
+ * 容器已满时 push_back/insert 返回 false 而不是扩容，由调用者决定如何处理。
+ * @tparam T 元素类型 (需要可默认构造；移除的元素会被重置为 T{}，以释放其持有的资源)
+ * @tparam N 容量
+ */
+template <typename T, std::size_t N>
+class FixedVector {
+private:
+    std::array<T, N> items_{};      ///< @brief 元素存储 ([0, size_) 有效)
+    std::size_t size_ = 0;          ///< @brief 元素数量
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() { return items_.data(); }
+    iterator end() { return items_.data() + size_; }
+    const_iterator begin() const { return items_.data(); }
+    const_iterator end() const { return items_.data() + size_; }
+
+    T& operator[](std::size_t index) { return items_[index]; }
+    const T& operator[](std::size_t index) const { return items_[index]; }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ == N; }
+    static constexpr std::size_t capacity() { return N; }
+
+    /// @brief 在末尾追加元素，已满时返回 false
+    bool push_back(T value) {
+        if (full()) return false;
+        items_[size_++] = std::move(value);
+        return true;
+    }
+
+    /// @brief 在 pos 之前插入元素 (后面的元素依次后移)，已满时返回 false
+    bool insert(const_iterator pos, T value) {
+        if (full()) return false;
+        auto index = static_cast<std::size_t>(pos - begin());
+        for (auto i = size_; i > index; --i) {
+            items_[i] = std::move(items_[i - 1]);
+        }
+        items_[index] = std::move(value);
+        ++size_;
+        return true;
+    }
+
+    /// @brief 移除 pos 处的元素 (后面的元素依次前移，保持顺序)
+    void erase(const_iterator pos) {
+        auto index = static_cast<std::size_t>(pos - begin());
+        for (auto i = index + 1; i < size_; ++i) {
+            items_[i - 1] = std::move(items_[i]);
+        }
+        items_[--size_] = T{};
+    }
+
+    void clear() {
+        for (std::size_t i = 0; i < size_; ++i) items_[i] = T{};
+        size_ = 0;
+    }
+};
+
+} // namespace engine::utils
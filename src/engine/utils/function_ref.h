@@ -0,0 +1,35 @@
+#pragma once
+#include <type_traits>
+#include <utility>
+#include <memory>
+
+namespace engine::utils {
+
+template<typename Signature>
+class FunctionRef;
+
+/**
+ * @brief 轻量的、非拥有的可调用对象引用。
+ *
+ * 与 std::function 不同，它不会复制可调用对象，也不会分配内存，适合作为“在调用期间使用”的回调参数。
+ * @note 只引用可调用对象，调用者必须保证被引用对象在 FunctionRef 使用期间有效（不要保存它）。
+ */
+template<typename R, typename... Args>
+class FunctionRef<R(Args...)> {
+private:
+    void* object_ = nullptr;                        ///< @brief 被引用的可调用对象
+    R (*callback_)(void*, Args...) = nullptr;       ///< @brief 类型擦除后的调用函数
+
+public:
+    template<typename F>
+        requires (!std::is_same_v<std::remove_cvref_t<F>, FunctionRef> && std::is_invocable_r_v<R, F&, Args...>)
+    FunctionRef(F&& f) noexcept
+        : object_(const_cast<void*>(static_cast<const void*>(std::addressof(f)))),
+          callback_([](void* object, Args... args) -> R {
+              return (*static_cast<std::remove_reference_t<F>*>(object))(std::forward<Args>(args)...);
+          }) {}
+
+    R operator()(Args... args) const { return callback_(object_, std::forward<Args>(args)...); }
+};
+
+} // namespace engine::utils
@@ -0,0 +1,73 @@
+#include "pool_allocator.h"
+#include <bit>
+#include <new>
+
+namespace engine::utils {
+
+static_assert(PoolAllocator::MIN_CLASS_SIZE << (PoolAllocator::CLASS_COUNT - 1) == PoolAllocator::MAX_POOLED_SIZE,
+              "CLASS_COUNT 与 MAX_POOLED_SIZE 不一致");
+
+PoolAllocator& PoolAllocator::global() {
+    static PoolAllocator allocator;
+    return allocator;
+}
+
+std::size_t PoolAllocator::classIndex(std::size_t size) {
+    if (size <= MIN_CLASS_SIZE) return 0;
+    // 向上取整到2的幂，再换算成相对最小一级的偏移
+    return static_cast<std::size_t>(std::bit_width(size - 1)) - static_cast<std::size_t>(std::bit_width(MIN_CLASS_SIZE - 1));
+}
+
+void* PoolAllocator::allocate(std::size_t size) {
+    if (size > MAX_POOLED_SIZE) {
+        {
+            std::lock_guard lock(mutex_);
+            ++stats_.oversize_allocations;
+        }
+        return ::operator new(size);
+    }
+
+    auto index = classIndex(size);
+    std::lock_guard lock(mutex_);
+    auto*& head = free_lists_[index];
+    if (!head) {
+        // 空闲链表为空：申请新的内存块并切分成该级尺寸的槽位
+        auto& block = blocks_.emplace_back(std::make_unique<std::byte[]>(BLOCK_BYTES));
+        ++stats_.block_allocations;
+        stats_.reserved_bytes += BLOCK_BYTES;
+        auto slot_size = classSize(index);
+        for (auto offset = BLOCK_BYTES; offset >= slot_size; offset -= slot_size) {
+            auto* node = reinterpret_cast<FreeNode*>(block.get() + offset - slot_size);
+            node->next = head;
+            head = node;
+        }
+    }
+    auto* node = head;
+    head = node->next;
+    ++stats_.allocations;
+    ++stats_.live;
+    return node;
+}
+
+void PoolAllocator::deallocate(void* ptr, std::size_t size) noexcept {
+    if (!ptr) return;
+    if (size > MAX_POOLED_SIZE) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    auto index = classIndex(size);
+    std::lock_guard lock(mutex_);
+    auto* node = static_cast<FreeNode*>(ptr);
+    node->next = free_lists_[index];
+    free_lists_[index] = node;
+    ++stats_.deallocations;
+    --stats_.live;
+}
+
+PoolAllocatorStats PoolAllocator::getStats() {
+    std::lock_guard lock(mutex_);
+    return stats_;
+}
+
+} // namespace engine::utils
@@ -0,0 +1,71 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace engine::utils {
+
+/// @brief 池分配器的统计数据 (累计值，live/reserved 为当前值)
+struct PoolAllocatorStats {
+    std::uint64_t allocations = 0;          ///< @brief 从池中分配的次数
+    std::uint64_t deallocations = 0;        ///< @brief 归还给池的次数
+    std::uint64_t block_allocations = 0;    ///< @brief 池向系统申请新内存块的次数 (稳定运行时应不再增长)
+    std::uint64_t oversize_allocations = 0; ///< @brief 超过最大尺寸、直接走系统分配的次数
+    std::size_t live = 0;                   ///< @brief 当前从池中分配出去、尚未归还的数量
+    std::size_t reserved_bytes = 0;         ///< @brief 池持有的内存总量 (字节)
+};
+
+/**
+ * @brief 按尺寸分级的小对象分配器。
+ *
+ * 请求的尺寸向上取整到 32, 64, ..., MAX_POOLED_SIZE 中最近的一级，每一级维护一个空闲链表，
+ * 空闲链表为空时一次申请 BLOCK_BYTES 大小的内存块切分使用。内存块只在析构时释放，
+ * 因此频繁创建/销毁的对象 (特效、道具等) 在稳定运行时不会再产生系统内存分配。
+ * 超过 MAX_POOLED_SIZE 的请求直接转交 ::operator new。所有操作由互斥锁保护。
+ * @note 分配出的内存按 16 字节对齐，不适用于对齐要求更高的类型。
+ */
+class PoolAllocator final {
+public:
+    static constexpr std::size_t MIN_CLASS_SIZE = 32;       ///< @brief 最小一级的尺寸
+    static constexpr std::size_t MAX_POOLED_SIZE = 2048;    ///< @brief 最大一级的尺寸
+    static constexpr std::size_t BLOCK_BYTES = 16 * 1024;   ///< @brief 每次向系统申请的内存块大小
+    static constexpr std::size_t CLASS_COUNT = 7;           ///< @brief 尺寸级数 (32 ~ 2048)
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    std::array<FreeNode*, CLASS_COUNT> free_lists_{};       ///< @brief 每一级的空闲链表
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;      ///< @brief 已申请的内存块
+    PoolAllocatorStats stats_;                              ///< @brief 统计数据
+    std::mutex mutex_;                                      ///< @brief 保护以上数据
+
+public:
+    PoolAllocator() = default;
+    ~PoolAllocator() = default;
+
+    // 禁止拷贝和移动
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+    PoolAllocator(PoolAllocator&&) = delete;
+    PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+    /// @brief 获取全局实例 (GameObject 和组件的 operator new 使用)
+    static PoolAllocator& global();
+
+    void* allocate(std::size_t size);                       ///< @brief 分配 size 字节
+    void deallocate(void* ptr, std::size_t size) noexcept;  ///< @brief 释放内存，size 必须与分配时相同
+    PoolAllocatorStats getStats();                          ///< @brief 获取统计数据的快照
+
+private:
+    /// @brief 尺寸对应的级别序号
+    static std::size_t classIndex(std::size_t size);
+    /// @brief 级别序号对应的尺寸
+    static constexpr std::size_t classSize(std::size_t index) { return MIN_CLASS_SIZE << index; }
+};
+
+} // namespace engine::utils
@@ -0,0 +1,43 @@
+#include "string_interner.h"
+
+namespace engine::utils {
+
+StringInterner::StringInterner() {
+    intern("");
+}
+
+StringInterner& StringInterner::global() {
+    static StringInterner interner;
+    return interner;
+}
+
+StringId StringInterner::intern(std::string_view str) {
+    std::lock_guard lock(mutex_);
+    if (auto it = ids_.find(str); it != ids_.end()) {
+        return it->second;
+    }
+    auto id = static_cast<StringId>(strings_.size());
+    const auto& stored = strings_.emplace_back(str);
+    ids_.emplace(std::string_view(stored), id);
+    return id;
+}
+
+std::optional<StringId> StringInterner::find(std::string_view str) const {
+    std::lock_guard lock(mutex_);
+    if (auto it = ids_.find(str); it != ids_.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+std::string_view StringInterner::view(StringId id) const {
+    std::lock_guard lock(mutex_);
+    return id < strings_.size() ? std::string_view(strings_[id]) : std::string_view();
+}
+
+std::size_t StringInterner::size() const {
+    std::lock_guard lock(mutex_);
+    return strings_.size();
+}
+
+} // namespace engine::utils
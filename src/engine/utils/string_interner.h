@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace engine::utils {
+
+/// @brief 驻留字符串的ID，相同内容的字符串ID相同，可以直接用整数比较
+using StringId = std::uint32_t;
+constexpr StringId EMPTY_STRING_ID = 0;     ///< @brief 空字符串的ID
+
+/**
+ * @brief 字符串驻留池：每个不同的字符串只保存一份，并分配一个稳定的整数ID。
+ *
+ * 驻留的字符串在程序运行期间不会被释放或移动，view() 返回的 string_view 可以长期保存。
+ * 所有操作由互斥锁保护 (可在后台线程加载关卡时使用)，热路径应保存 ID 或 string_view 而不是反复查询。
+ */
+class StringInterner final {
+private:
+    std::deque<std::string> strings_;                           ///< @brief 驻留的字符串 (以ID为下标，deque 追加时不移动已有元素)
+    std::unordered_map<std::string_view, StringId> ids_;        ///< @brief 字符串 -> ID (键指向 strings_ 中的内容)
+    mutable std::mutex mutex_;                                  ///< @brief 保护以上数据
+
+public:
+    StringInterner();       ///< @brief 构造时驻留空字符串，使其ID为 EMPTY_STRING_ID
+
+    // 禁止拷贝和移动
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+    StringInterner(StringInterner&&) = delete;
+    StringInterner& operator=(StringInterner&&) = delete;
+
+    /// @brief 获取全局实例
+    static StringInterner& global();
+
+    StringId intern(std::string_view str);                      ///< @brief 驻留字符串并返回ID (已存在时直接返回)
+    std::optional<StringId> find(std::string_view str) const;   ///< @brief 查找已驻留字符串的ID (不会新增)
+    std::string_view view(StringId id) const;                   ///< @brief 获取ID对应的字符串 (无效ID返回空字符串)
+    std::size_t size() const;                                   ///< @brief 已驻留的字符串数量
+};
+
+/// @brief 在全局驻留池中驻留字符串
+inline StringId internString(std::string_view str) { return StringInterner::global().intern(str); }
+
+} // namespace engine::utils
@@ -34,6 +34,10 @@ private:
     engine::component::AudioComponent* audio_component_ = nullptr;
 
 public:
+    static constexpr bool HAS_RENDER = false;   ///< @brief 不参与渲染
+    /// @brief 行为只访问自身对象的组件，可并行更新；在物理更新前设置速度
+    static constexpr engine::component::UpdatePhase UPDATE_PHASE = engine::component::UpdatePhase::AI;
+
     AIComponent() = default;
     ~AIComponent() override = default;
 
@@ -57,6 +57,8 @@ private:
     float flash_timer_ = 0.0f;                      ///< @brief 闪烁计时器，用于无敌状态下的闪烁效果
 
 public:
+    static constexpr bool HAS_RENDER = false;   ///< @brief 不参与渲染
+
     PlayerComponent() = default;
     ~PlayerComponent() override = default;
 
@@ -6,7 +6,7 @@
 
 namespace game::component::state {
 
-void PlayerState::playAnimation(const std::string& animation_name) {
+void PlayerState::playAnimation(std::string_view animation_name) {
     if (!player_component_) {
         spdlog::error("PlayerState 没有关联的 PlayerComponent，无法播放动画 '{}'", animation_name);
         return;
@@ -1,6 +1,6 @@
 #pragma once
 #include <memory>
-#include <string>
+#include <string_view>
 
 namespace engine::core {
     class Context;
@@ -30,7 +30,7 @@ public:
     PlayerState(PlayerState&&) = delete;
     PlayerState& operator=(PlayerState&&) = delete;
 
-    void playAnimation(const std::string& animation_name);      ///< @brief 播放指定名称的动画，使用 AnimationComponent 的方法
+    void playAnimation(std::string_view animation_name);      ///< @brief 播放指定名称的动画，使用 AnimationComponent 的方法
 
 protected:
     // 核心状态方法
@@ -1,4 +1,5 @@
 #include "session_data.h"
+#include "../../engine/scene/level_loader.h"
 #include <fstream>
 #include <filesystem>
 #include <nlohmann/json.hpp>
@@ -7,6 +8,8 @@
 
 namespace game::data {
 
+SessionData::~SessionData() = default;
+
 void SessionData::setCurrentHealth(int health) {
     // 将生命值限制在 0 和 max_health_ 之间
     current_health_ = glm::clamp(health, 0, max_health_);
@@ -142,4 +145,15 @@ bool SessionData::syncHighScore(std::string_view filename)
     }
 }
 
+std::shared_ptr<engine::scene::LevelLoader> SessionData::getPreparedLevel(std::string_view map_path) const
+{
+    auto it = prepared_levels_.find(std::string(map_path));
+    return it != prepared_levels_.end() ? it->second : nullptr;
+}
+
+void SessionData::setPreparedLevel(std::string_view map_path, std::shared_ptr<engine::scene::LevelLoader> level)
+{
+    prepared_levels_[std::string(map_path)] = std::move(level);
+}
+
 } // namespace game::state 
\ No newline at end of file
@@ -2,8 +2,13 @@
 #include <string>
 #include <string_view>
 #include <memory>
+#include <unordered_map>
 #include <nlohmann/json.hpp> 
 
+namespace engine::scene {
+    class LevelLoader;
+}
+
 namespace game::data {
 
 /**
@@ -24,9 +29,12 @@ private:
     int level_score_ = 0;           ///< @brief 进入关卡时的得分（读/存档用）
     std::string map_path_ = "assets/maps/level1.tmj";
 
+    /// @brief 地图路径 -> 准备好的关卡数据 (重开或再次进入关卡时不再读取和解析文件，不写入存档)
+    std::unordered_map<std::string, std::shared_ptr<engine::scene::LevelLoader>> prepared_levels_;
+
 public:
     SessionData() = default;
-    ~SessionData() = default;
+    ~SessionData();             // LevelLoader 只有前置声明，析构函数定义在cpp中
 
     // 删除复制和移动操作以防止意外复制
     SessionData(const SessionData&) = delete;
@@ -54,6 +62,11 @@ public:
     void setMapPath(std::string_view map_path) { map_path_ = map_path; }
     void setIsWin(bool is_win) { is_win_ = is_win; }
 
+    /// @brief 获取缓存的准备好的关卡 (没有时返回 nullptr)
+    std::shared_ptr<engine::scene::LevelLoader> getPreparedLevel(std::string_view map_path) const;
+    /// @brief 缓存准备好的关卡 (覆盖同一关卡的旧数据)
+    void setPreparedLevel(std::string_view map_path, std::shared_ptr<engine::scene::LevelLoader> level);
+
     void reset();                                           ///< @brief 重置游戏数据以准备开始新游戏（保留最高分）
     void setNextLevel(std::string_view map_path);         ///< @brief 设置下一个场景信息（地图、关卡开始时的得分生命）
     bool saveToFile(std::string_view filename) const;     ///< @brief 将当前游戏数据保存到JSON文件（存档）
@@ -13,6 +13,7 @@
 #include "../../engine/component/animation_component.h"
 #include "../../engine/component/health_component.h"
 #include "../../engine/physics/physics_engine.h"
+#include "../../engine/physics/collision_layer.h"
 #include "../../engine/scene/level_loader.h"
 #include "../../engine/scene/scene_manager.h"
 #include "../../engine/input/input_manager.h"
@@ -35,17 +36,47 @@
 
 namespace game::scene {
 
+namespace {
+// 游戏逻辑中用到的名称和标签的驻留ID (程序启动时驻留，运行中只做整数比较)
+const engine::utils::StringId TAG_ENEMY = engine::utils::internString("enemy");
+const engine::utils::StringId TAG_ITEM = engine::utils::internString("item");
+const engine::utils::StringId TAG_NEXT_LEVEL = engine::utils::internString("next_level");
+const engine::utils::StringId NAME_EAGLE = engine::utils::internString("eagle");
+const engine::utils::StringId NAME_FROG = engine::utils::internString("frog");
+const engine::utils::StringId NAME_OPOSSUM = engine::utils::internString("opossum");
+const engine::utils::StringId NAME_WIN = engine::utils::internString("win");
+const engine::utils::StringId NAME_FRUIT = engine::utils::internString("fruit");
+const engine::utils::StringId NAME_GEM = engine::utils::internString("gem");
+} // namespace
+
 GameScene::GameScene(engine::core::Context& context, 
                      engine::scene::SceneManager& scene_manager,
-                     std::shared_ptr<game::data::SessionData> data)
-    : Scene("GameScene", context, scene_manager), game_session_data_(std::move(data)) {
+                     std::shared_ptr<game::data::SessionData> data,
+                     std::string_view next_map_path)
+    : Scene("GameScene", context, scene_manager), game_session_data_(std::move(data)),
+      map_path_(next_map_path), is_next_level_(!next_map_path.empty()) {
     if (!game_session_data_) {      // 如果没有传入SessionData，则创建一个默认的
         game_session_data_ = std::make_shared<game::data::SessionData>();
         spdlog::info("未提供 SessionData，使用默认值。");
     }
+    if (!is_next_level_) {
+        map_path_ = game_session_data_->getMapPath();
+    }
+    level_loader_ = game_session_data_->getPreparedLevel(map_path_);
     spdlog::trace("GameScene 构造完成。");
 }
 
+GameScene::~GameScene() = default;
+
+bool GameScene::prepare(const std::function<void(float)>& report_progress)
+{
+    if (level_loader_) {        // 关卡数据已在内存中，无需准备
+        return true;
+    }
+    level_loader_ = std::make_shared<engine::scene::LevelLoader>();
+    return level_loader_->prepareLevel(map_path_, &context_.getResourceManager(), report_progress);
+}
+
 void GameScene::init() {
     if (is_initialized_) {
         spdlog::warn("GameScene 已经初始化过了，重复调用 init()。");
@@ -53,6 +84,9 @@ void GameScene::init() {
     }
     spdlog::trace("GameScene 初始化开始...");
     context_.getGameState().setState(engine::core::State::Playing);
+    if (is_next_level_) {       // 此时才真正切换到新关卡：记录地图和关卡开始时的得分、生命
+        game_session_data_->setNextLevel(map_path_);
+    }
     game_session_data_->syncHighScore("assets/save.json");      // 更新最高分
 
     if (!initLevel()) {
@@ -89,8 +123,8 @@ void GameScene::update(float delta_time) {
     handleTileTriggers();
 
     // 玩家掉出地图下方则判断为失败
-    if (player_ ) {
-        auto pos = player_->getComponent<engine::component::TransformComponent>()->getPosition();
+    if (auto* player = getPlayer(); player) {
+        auto pos = player->getComponent<engine::component::TransformComponent>()->getPosition();
         auto world_rect = context_.getPhysicsEngine().getWorldBounds();
         // 多100像素冗余量
         if (world_rect && pos.y > world_rect->position.y + world_rect->size.y + 100.0f) {
@@ -119,13 +153,21 @@ void GameScene::clean() {
 
 bool GameScene::initLevel()
 {
-    // 加载关卡（level_loader通常加载完成后即可销毁，因此不存为成员变量）
-    engine::scene::LevelLoader level_loader;
-    auto level_path = game_session_data_->getMapPath();
-    if (!level_loader.loadLevel(level_path, *this)){
+    // 加载关卡：未在后台准备 (也没有缓存) 时同步准备，创建对象后缓存准备好的数据，重开或再次进入关卡时直接创建
+    if (!level_loader_ || !level_loader_->isPrepared()) {
+        level_loader_ = std::make_shared<engine::scene::LevelLoader>();
+        if (!level_loader_->prepareLevel(map_path_)) {
+            spdlog::error("关卡加载失败");
+            level_loader_.reset();
+            return false;
+        }
+    }
+    if (!level_loader_->buildLevel(*this)) {
         spdlog::error("关卡加载失败");
+        level_loader_.reset();
         return false;
     }
+    game_session_data_->setPreparedLevel(map_path_, level_loader_);
 
     // 注册"main"层到物理引擎
     auto* main_layer = findGameObjectByName("main");
@@ -155,22 +197,23 @@ bool GameScene::initLevel()
 
 bool GameScene::initPlayer()
 {
-    // 获取玩家对象
-    player_ = findGameObjectByName("player");
-    if (!player_) {
+    // 获取玩家对象，之后通过句柄访问
+    auto* player = findGameObjectByName("player");
+    if (!player) {
         spdlog::error("未找到玩家对象");
         return false;
     }
+    player_handle_ = player->getHandle();
 
     // 添加PlayerComponent到玩家对象
-    auto* player_component = player_->addComponent<game::component::PlayerComponent>();
+    auto* player_component = player->addComponent<game::component::PlayerComponent>();
     if (!player_component) {
         spdlog::error("无法添加 PlayerComponent 到玩家对象");
         return false;
     }
 
     // 从SessionData中更新玩家生命值
-    if (auto health_component = player_->getComponent<engine::component::HealthComponent>(); health_component) {
+    if (auto health_component = player->getComponent<engine::component::HealthComponent>(); health_component) {
         health_component->setMaxHealth(game_session_data_->getMaxHealth());
         health_component->setCurrentHealth(game_session_data_->getCurrentHealth());
     } else {
@@ -179,12 +222,11 @@ bool GameScene::initPlayer()
     }
 
     // 相机跟随玩家
-    auto* player_transform = player_->getComponent<engine::component::TransformComponent>();
-    if (!player_transform) {
+    if (!player->getComponent<engine::component::TransformComponent>()) {
         spdlog::error("玩家对象没有 TransformComponent 组件, 无法设置相机目标");
         return false;
     }
-    context_.getCamera().setTarget(player_transform);
+    context_.getCamera().setTarget(player_handle_);
     spdlog::trace("Player初始化完成。");
     return true;
 }
@@ -193,28 +235,29 @@ bool GameScene::initEnemyAndItem()
 {
     bool success = true;
     for (auto& game_object : game_objects_){
-        if (game_object->getName() == "eagle"){
+        if (!game_object) continue;     // 直接移除的对象留下的空位
+        if (game_object->getNameId() == NAME_EAGLE){
             if (auto* ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component){
                 auto y_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().y;
                 auto y_min = y_max - 80.0f;    // 让鹰的飞行范围 (当前位置与上方80像素 的区域)
                 ai_component->setBehavior(std::make_unique<game::component::ai::UpDownBehavior>(y_min, y_max));
             }
         }
-        if (game_object->getName() == "frog"){
+        if (game_object->getNameId() == NAME_FROG){
             if (auto* ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component){
                 auto x_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().x - 10.0f;
                 auto x_min = x_max - 90.0f;    // 青蛙跳跃范围（右侧 - 10.0f 是为了增加稳定性）
                 ai_component->setBehavior(std::make_unique<game::component::ai::JumpBehavior>(x_min, x_max));
             }
         }
-        if (game_object->getName() == "opossum"){
+        if (game_object->getNameId() == NAME_OPOSSUM){
             if (auto* ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component){
                 auto x_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().x;
                 auto x_min = x_max - 200.0f;    // 负鼠巡逻范围
                 ai_component->setBehavior(std::make_unique<game::component::ai::PatrolBehavior>(x_min, x_max));
             }
         }
-        if (game_object->getTag() == "item"){
+        if (game_object->getTagId() == TAG_ITEM){
             if (auto* ac = game_object->getComponent<engine::component::AnimationComponent>(); ac){
                 ac->playAnimation("idle");
             } else {
@@ -237,72 +280,91 @@ bool GameScene::initUI()
 
 void GameScene::handleObjectCollisions()
 {
-    // 从物理引擎中获取碰撞对
-    auto collision_pairs = context_.getPhysicsEngine().getCollisionPairs();
-    for (const auto& pair : collision_pairs) {
-        auto* obj1 = pair.first;
-        auto* obj2 = pair.second;
-
-        // 处理玩家与敌人的碰撞
-        if (obj1->getName() == "player" && obj2->getTag() == "enemy") {
-            playerVSEnemyCollision(obj1, obj2);
-        } else if (obj2->getName() == "player" && obj1->getTag() == "enemy") {
-            playerVSEnemyCollision(obj2, obj1);
-        }
-        // 处理玩家与道具的碰撞
-        else if (obj1->getName() == "player" && obj2->getTag() == "item") {
-            playerVSItemCollision(obj1, obj2);
-        } else if (obj2->getName() == "player" && obj1->getTag() == "item") {
-            playerVSItemCollision(obj2, obj1);
-        }
-        // 处理玩家与"hazard"对象碰撞
-        else if (obj1->getName() == "player" && obj2->getTag() == "hazard") {
-            handlePlayerDamage(1);
-            spdlog::debug("玩家 {} 受到了 HAZARD 对象伤害", obj1->getName());
-        } else if (obj2->getName() == "player" && obj1->getTag() == "hazard") {
-            handlePlayerDamage(1);
-            spdlog::debug("玩家 {} 受到了 HAZARD 对象伤害", obj2->getName());
-        }
-        // 处理玩家与关底触发器碰撞
-        else if (obj1->getName() == "player" && obj2->getTag() == "next_level") {
-            toNextLevel(obj2);
-        } else if (obj2->getName() == "player" && obj1->getTag() == "next_level") {
-            toNextLevel(obj1);
-        }
-        // 处理玩家与结束触发器碰撞
-        else if (obj1->getName() == "player" && obj2->getName() == "win") {
-            showEndScene(true);
-        } else if (obj2->getName() == "player" && obj1->getName() == "win") {
-            showEndScene(true);
-        }
+    // 从物理引擎中获取碰撞事件 (引用即可，无需拷贝)
+    const auto& physics_engine = context_.getPhysicsEngine();
+    // 新产生的接触：所有类型都要处理
+    for (const auto& [obj1, obj2] : physics_engine.getCollisionBeginPairs()) {
+        handleCollisionPair(obj1, obj2, true);
+    }
+    // 持续的接触：道具、关卡触发器只需在接触开始时处理一次
+    for (const auto& [obj1, obj2] : physics_engine.getCollisionStayPairs()) {
+        handleCollisionPair(obj1, obj2, false);
+    }
+}
+
+void GameScene::handleCollisionPair(engine::object::GameObject* obj1, engine::object::GameObject* obj2, bool is_begin)
+{
+    namespace CollisionLayer = engine::physics::CollisionLayer;
+    // 碰撞对中的对象必然拥有碰撞组件，通过碰撞类别分派，避免字符串比较
+    auto* cc1 = obj1->getComponent<engine::component::ColliderComponent>();
+    auto* cc2 = obj2->getComponent<engine::component::ColliderComponent>();
+    if (!cc1 || !cc2) return;
+
+    // 目前只关心与玩家相关的碰撞，统一让 obj1 为玩家
+    if (cc2->getCategory() & CollisionLayer::PLAYER) {
+        std::swap(obj1, obj2);
+        std::swap(cc1, cc2);
+    }
+    if (!(cc1->getCategory() & CollisionLayer::PLAYER)) {
+        return;
+    }
+    auto category = cc2->getCategory();
+
+    // 处理玩家与敌人的碰撞 (持续接触时，无敌时间结束后会再次受伤)
+    if (category & CollisionLayer::ENEMY) {
+        playerVSEnemyCollision(obj1, obj2);
+    }
+    // 处理玩家与"hazard"对象碰撞 (同上)
+    else if (category & CollisionLayer::HAZARD) {
+        handlePlayerDamage(1);
+        spdlog::debug("玩家 {} 受到了 HAZARD 对象伤害", obj1->getName());
+    }
+    // 以下碰撞只在接触开始时处理
+    else if (!is_begin) {
+        return;
+    }
+    // 处理玩家与道具的碰撞
+    else if (category & CollisionLayer::ITEM) {
+        playerVSItemCollision(obj1, obj2);
+    }
+    // 处理玩家与关底触发器碰撞
+    else if ((category & CollisionLayer::TRIGGER) && obj2->getTagId() == TAG_NEXT_LEVEL) {
+        toNextLevel(obj2);
+    }
+    // 处理玩家与结束触发器碰撞
+    else if (obj2->getNameId() == NAME_WIN) {
+        showEndScene(true);
     }
 }
 
 void GameScene::handleTileTriggers()
 {
-    const auto& tile_trigger_events = context_.getPhysicsEngine().getTileTriggerEvents();
-    for (const auto& event : tile_trigger_events) {
-        auto* obj = event.first;        // 瓦片触发事件的对象
-        auto tile_type = event.second;  // 瓦片类型
-        if (tile_type == engine::component::TileType::HAZARD) {
-            // 玩家碰到到危险瓦片，受伤
-            if (obj->getName() == "player") {       
-                handlePlayerDamage(1);
-                spdlog::debug("玩家 {} 受到了 HAZARD 瓦片伤害", obj->getName());
-            } 
-            // TODO: 其他对象类型的处理，目前让敌人无视瓦片伤害
-        }
+    // 进入/离开事件只在触发器状态变化时产生，这里仅用于调试输出
+    for (const auto& event : context_.getPhysicsEngine().getTileTriggerEvents()) {
+        spdlog::debug("GameObject {} {} 瓦片触发器 {}", event.object->getName(), event.entered ? "进入" : "离开", event.trigger);
+    }
+
+    // 玩家处在危险瓦片上时持续受伤 (受伤后的无敌时间由 PlayerComponent 处理)，因此直接读取当前的触发器掩码
+    auto* player = getPlayer();
+    if (!player) return;
+    auto* physics_component = player->getComponent<engine::component::PhysicsComponent>();
+    if (physics_component && (physics_component->getTileTriggers() & engine::physics::TileTrigger::HAZARD)) {
+        handlePlayerDamage(1);
+        spdlog::debug("玩家 {} 受到了 HAZARD 瓦片伤害", player->getName());
     }
+    // TODO: 其他对象类型的处理，目前让敌人无视瓦片伤害
 }
 
 void GameScene::handlePlayerDamage(int damage)
 {
-    auto player_component = player_->getComponent<game::component::PlayerComponent>();
+    auto* player = getPlayer();
+    if (!player) return;
+    auto player_component = player->getComponent<game::component::PlayerComponent>();
     if (!player_component->takeDamage(damage)) { // 没有受伤，直接返回
         return;
     }
     if (player_component->isDead()) {
-        spdlog::info("玩家 {} 死亡", player_->getName());
+        spdlog::info("玩家 {} 死亡", player->getName());
         // TODO: 可能的死亡逻辑处理
     }
     // 更新生命值及HealthUI
@@ -330,7 +392,7 @@ void GameScene::playerVSEnemyCollision(engine::object::GameObject *player, engin
         if (!enemy_health->isAlive()) {
             spdlog::info("敌人 {} 被踩踏后死亡", enemy->getName());
             enemy->setNeedRemove(true);  // 标记敌人为待删除状态
-            createEffect(enemy_center, enemy->getTag());  // 创建（死亡）特效
+            createEffect(enemy_center, enemy->getTagId());  // 创建（死亡）特效
         }
         // 玩家跳起效果
         player->getComponent<engine::component::PhysicsComponent>()->velocity_.y = -300.0f;  // 向上跳起
@@ -348,24 +410,29 @@ void GameScene::playerVSEnemyCollision(engine::object::GameObject *player, engin
 
 void GameScene::playerVSItemCollision(engine::object::GameObject*, engine::object::GameObject * item)
 {
-    if (item->getName() == "fruit") {
+    if (item->getNameId() == NAME_FRUIT) {
         healWithUI(1);        // 加血
-    } else if (item->getName() == "gem") {
+    } else if (item->getNameId() == NAME_GEM) {
         addScoreWithUI(5);    // 加5分
     }
     item->setNeedRemove(true);  // 标记道具为待删除状态
     auto item_aabb = item->getComponent<engine::component::ColliderComponent>()->getWorldAABB();
-    createEffect(item_aabb.position + item_aabb.size / 2.0f, item->getTag());  // 创建特效
+    createEffect(item_aabb.position + item_aabb.size / 2.0f, item->getTagId());  // 创建特效
     context_.getAudioPlayer().playSound("assets/audio/poka01.mp3");         // 播放音效
 }
 
 void GameScene::toNextLevel(engine::object::GameObject *trigger)
 {
+    if (scene_manager_.isLoading()) {       // 下一关正在后台加载，触发器的持续碰撞不再重复请求
+        return;
+    }
     auto scene_name = trigger->getName();
     auto map_path = levelNameToPath(scene_name);
-    game_session_data_->setNextLevel(map_path);     // 设置下一个关卡信息
-    auto next_scene = std::make_unique<game::scene::GameScene>(context_, scene_manager_, game_session_data_);
-    scene_manager_.requestReplaceScene(std::move(next_scene));
+    // 下一关的信息在它替换当前场景 (init) 时才写入 SessionData，后台加载期间当前关卡照常运行
+    auto next_scene = std::make_unique<game::scene::GameScene>(context_, scene_manager_, game_session_data_, map_path);
+    scene_manager_.requestReplaceSceneAsync(std::move(next_scene), [](float progress) {
+        spdlog::debug("下一关加载进度: {:.0f}%", progress * 100.0f);
+    });
 }
 
 void GameScene::showEndScene(bool is_win)
@@ -376,40 +443,52 @@ void GameScene::showEndScene(bool is_win)
     scene_manager_.requestPushScene(std::move(end_scene));
 }
 
-void GameScene::createEffect(glm::vec2 center_pos, std::string_view tag)
+void GameScene::createEffect(glm::vec2 center_pos, engine::utils::StringId tag_id)
 {
-    // --- 创建游戏对象和变换组件 ---
-    auto effect_obj = std::make_unique<engine::object::GameObject>("effect_" + std::string(tag));
-    effect_obj->addComponent<engine::component::TransformComponent>(std::move(center_pos));
-
-    // --- 根据标签创建不同的精灵组件和动画--- 
-    auto animation = std::make_unique<engine::render::Animation>("effect", false);
-    if (tag == "enemy") {
-        effect_obj->addComponent<engine::component::SpriteComponent>("assets/textures/FX/enemy-deadth.png", 
-                                                                    context_.getResourceManager(),
-                                                                    engine::utils::Alignment::CENTER);
-        for (auto i = 0; i < 5; ++i) {
-            animation->addFrame({static_cast<float>(i * 40), 0.0f, 40.0f, 41.0f}, 0.1f);
-        }
-    } else if (tag == "item") {
-        effect_obj->addComponent<engine::component::SpriteComponent>("assets/textures/FX/item-feedback.png", 
-                                                                    context_.getResourceManager(),
-                                                                    engine::utils::Alignment::CENTER);
-        for (auto i = 0; i < 4; ++i) {
-            animation->addFrame({static_cast<float>(i * 32), 0.0f, 32.0f, 32.0f}, 0.1f);
-        }
+    // --- 根据标签选择纹理和动画 (动画数据只在第一次使用时创建，之后所有同类特效共享) ---
+    std::string_view effect_name;
+    std::string_view texture_id;
+    std::shared_ptr<engine::render::Animation> animation;
+    if (tag_id == TAG_ENEMY) {
+        effect_name = "effect_enemy";
+        texture_id = "assets/textures/FX/enemy-deadth.png";
+        if (!enemy_effect_animation_) enemy_effect_animation_ = createEffectAnimation(5, {40.0f, 41.0f});
+        animation = enemy_effect_animation_;
+    } else if (tag_id == TAG_ITEM) {
+        effect_name = "effect_item";
+        texture_id = "assets/textures/FX/item-feedback.png";
+        if (!item_effect_animation_) item_effect_animation_ = createEffectAnimation(4, {32.0f, 32.0f});
+        animation = item_effect_animation_;
     } else {
-        spdlog::warn("未知特效类型: {}", tag);
+        spdlog::warn("未知特效类型: {}", engine::utils::StringInterner::global().view(tag_id));
         return;
     }
 
-    // --- 根据创建的动画，添加动画组件，并设置为单次播放 ---
+    // --- 创建游戏对象、变换组件和精灵组件 (对象与组件都从池中分配) ---
+    auto effect_obj = std::make_unique<engine::object::GameObject>(effect_name);
+    effect_obj->addComponent<engine::component::TransformComponent>(std::move(center_pos));
+    effect_obj->addComponent<engine::component::SpriteComponent>(texture_id,
+                                                                context_.getResourceManager(),
+                                                                engine::utils::Alignment::CENTER);
+
+    // --- 添加动画组件，并设置为单次播放 ---
     auto* animation_component = effect_obj->addComponent<engine::component::AnimationComponent>();
+    auto animation_id = animation->getNameId();
     animation_component->addAnimation(std::move(animation));
     animation_component->setOneShotRemoval(true);
-    animation_component->playAnimation("effect");
+    animation_component->playAnimation(animation_id);
     safeAddGameObject(std::move(effect_obj));  // 安全添加特效对象
-    spdlog::debug("创建特效: {}", tag);
+    spdlog::debug("创建特效: {}", effect_name);
+}
+
+std::shared_ptr<engine::render::Animation> GameScene::createEffectAnimation(int frame_count, glm::vec2 frame_size)
+{
+    // 特效图集为水平排列的等宽帧，每帧 0.1 秒，单次播放
+    auto animation = std::make_shared<engine::render::Animation>("effect", false);
+    for (auto i = 0; i < frame_count; ++i) {
+        animation->addFrame({static_cast<float>(i) * frame_size.x, 0.0f, frame_size.x, frame_size.y}, 0.1f);
+    }
+    return animation;
 }
 
 void GameScene::createScoreUI() {
@@ -463,12 +542,13 @@ void GameScene::createHealthUI() {
 
 void GameScene::updateHealthWithUI()
 {
-    if (!player_ || !health_panel_) {
+    auto* player = getPlayer();
+    if (!player || !health_panel_) {
         spdlog::error("玩家对象或 HealthPanel 不存在，无法更新生命值UI");
         return;
     }
     // 获取当前生命值并更新游戏数据
-    auto current_health = player_->getComponent<engine::component::HealthComponent>()->getCurrentHealth();
+    auto current_health = player->getComponent<engine::component::HealthComponent>()->getCurrentHealth();
     game_session_data_->setCurrentHealth(current_health);
     auto max_health = game_session_data_->getMaxHealth();
 
@@ -488,7 +568,9 @@ void GameScene::addScoreWithUI(int score)
 
 void GameScene::healWithUI(int amount)
 {
-    player_->getComponent<engine::component::HealthComponent>()->heal(amount);
+    if (auto* player = getPlayer(); player) {
+        player->getComponent<engine::component::HealthComponent>()->heal(amount);
+    }
     updateHealthWithUI();                              // 更新生命值与UI
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "../../engine/scene/scene.h"
 #include <memory>
+#include <string>
 #include <string_view>
 #include <glm/vec2.hpp>
 
@@ -13,6 +14,14 @@ namespace game::data {
     class SessionData;
 }
 
+namespace engine::render {
+    class Animation;
+}
+
+namespace engine::scene {
+    class LevelLoader;
+}
+
 namespace engine::ui {
     class UILabel;
     class UIPanel;
@@ -25,15 +34,31 @@ namespace game::scene {
  */
 class GameScene final: public engine::scene::Scene {
     std::shared_ptr<game::data::SessionData> game_session_data_;    ///< @brief 场景间共享数据，因此用shared_ptr
-    engine::object::GameObject* player_ = nullptr;                  ///< @brief 保存玩家对象的指针，方便访问
+    engine::object::ObjectHandle player_handle_;                    ///< @brief 玩家对象的句柄 (玩家被移除后自动失效)
 
     engine::ui::UILabel* score_label_ = nullptr;        ///< @brief 得分标签 (生命周期由UIManager管理，因此使用裸指针)
     engine::ui::UIPanel* health_panel_ = nullptr;       ///< @brief 生命值图标面板
 
+    // --- 特效动画缓存：同类特效共享同一份动画数据，避免每次创建特效时重新构建 ---
+    std::shared_ptr<engine::render::Animation> enemy_effect_animation_;   ///< @brief 敌人死亡特效动画
+    std::shared_ptr<engine::render::Animation> item_effect_animation_;    ///< @brief 道具拾取特效动画
+
+    std::string map_path_;          ///< @brief 本场景的地图文件路径
+    bool is_next_level_ = false;    ///< @brief 是否由上一关进入 (init 时才把关卡信息写入 SessionData)
+
+    /// @brief 准备好的关卡数据 (之前进入过该关卡时取自 SessionData 的缓存，否则在 prepare/init 中准备)
+    std::shared_ptr<engine::scene::LevelLoader> level_loader_;
+
 public:
+    /// @brief next_map_path 为空时进入 SessionData 中记录的关卡，否则作为下一关进入该地图
     GameScene(engine::core::Context& context, 
               engine::scene::SceneManager& scene_manager, 
-              std::shared_ptr<game::data::SessionData> data = nullptr);
+              std::shared_ptr<game::data::SessionData> data = nullptr,
+              std::string_view next_map_path = {});
+    ~GameScene() override;      // LevelLoader 只有前置声明，析构函数定义在cpp中
+
+    /// @brief 在加载线程上解析关卡地图并解码关卡图片 (对象在 init() 中创建)
+    bool prepare(const std::function<void(float)>& report_progress) override;
 
     // 覆盖场景基类的核心方法
     void init() override;
@@ -49,6 +74,8 @@ private:
     [[nodiscard]] bool initUI();                  ///< @brief 初始化UI
 
     void handleObjectCollisions();              ///< @brief 处理游戏对象间的碰撞逻辑（从PhysicsEngine获取信息）
+    /// @brief 处理单个碰撞对。is_begin 为 false 时（持续接触）只处理会反复生效的碰撞（敌人、危险物）
+    void handleCollisionPair(engine::object::GameObject* obj1, engine::object::GameObject* obj2, bool is_begin);
     void handleTileTriggers();                  ///< @brief 处理瓦片触发事件（从PhysicsEngine获取信息）
     void handlePlayerDamage(int damage);         ///< @brief 处理玩家受伤（更新得分、UI等）
     void playerVSEnemyCollision(engine::object::GameObject* player, engine::object::GameObject* enemy);  ///< @brief 玩家与敌人碰撞处理
@@ -57,15 +84,20 @@ private:
     void toNextLevel(engine::object::GameObject* trigger);          ///< @brief 进入下一个关卡
     void showEndScene(bool is_win);                                 ///< @brief 显示结束场景
 
+    /// @brief 获取玩家对象 (不存在时返回 nullptr)
+    engine::object::GameObject* getPlayer() const { return getGameObject(player_handle_); }
+
     /// @brief 根据关卡名称获取对应的地图文件路径
     std::string levelNameToPath(std::string_view level_name) const { return "assets/maps/" + std::string(level_name) + ".tmj"; }
 
     /**
      * @brief 创建一个特效对象（一次性）。
      * @param center_pos 特效中心位置
-     * @param tag 特效标签（决定特效类型,例如"enemy","item"）
+     * @param tag_id 特效标签的驻留ID（决定特效类型，例如"enemy","item"）
      */
-    void createEffect(glm::vec2 center_pos, std::string_view tag);
+    void createEffect(glm::vec2 center_pos, engine::utils::StringId tag_id);
+    /// @brief 创建特效动画 (水平排列的 frame_count 帧，每帧尺寸 frame_size)
+    static std::shared_ptr<engine::render::Animation> createEffectAnimation(int frame_count, glm::vec2 frame_size);
 
     // --- UI 相关函数 ---
     void createScoreUI();                           ///< @brief 创建得分UI